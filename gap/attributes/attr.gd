@@ -86,6 +86,4 @@ DeclareAttribute("TransposedMultiplicationTableWithCanonicalPositions",
 
 DeclareAttribute("MinimalFaithfulTransformationDegree", IsSemigroup);
 DeclareAttribute("SmallerDegreeTransformationRepresentation", IsSemigroup);
-
-# TODO(later)
-# DeclareAttribute("MinimalFaithfulTransformationRepresentation", IsSemigroup);
+DeclareAttribute("MinimalTransformationRepresentation", IsSemigroup);
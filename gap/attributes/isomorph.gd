@@ -13,4 +13,21 @@ DeclareAttribute("SmallestMultiplicationTable", IsSemigroup);
 DeclareAttribute("CanonicalMultiplicationTable", IsSemigroup);
 DeclareAttribute("CanonicalMultiplicationTablePerm", IsSemigroup);
 DeclareOperation("OnMultiplicationTable", [IsRectangularTable, IsPerm]);
+
+DeclareCategory("IsCompactMultiplicationTable", IsCopyable);
+BindGlobal("CompactMultiplicationTableFamily",
+           NewFamily("CompactMultiplicationTableFamily",
+                     IsCompactMultiplicationTable));
+BindGlobal("CompactMultiplicationTableType",
+           NewType(CompactMultiplicationTableFamily,
+                   IsCompactMultiplicationTable and IsDataObjectRep
+                   and IsMutable));
+
+DeclareAttribute("CompactMultiplicationTable", IsListOrCollection);
+DeclareOperation("ExpandedMultiplicationTable",
+                 [IsCompactMultiplicationTable]);
+DeclareOperation("OnMultiplicationTable",
+                 [IsCompactMultiplicationTable, IsPerm]);
 DeclareOperation("IsIsomorphicSemigroup", [IsSemigroup, IsSemigroup]);
+DeclareAttribute("SemigroupInvariantFingerprint", IsSemigroup);
+DeclareOperation("DeduplicateUpToIsomorphism", [IsList]);
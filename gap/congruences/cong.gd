@@ -124,6 +124,9 @@ DeclareOperation("CongruenceTestMembershipNC",
                  [IsLeftRightOrTwoSidedCongruence,
                   IsMultiplicativeElement,
                   IsMultiplicativeElement]);
+# Batch version, returns a list of booleans for a list of pairs of elements
+DeclareOperation("CongruenceTestMembershipNC",
+                 [IsLeftRightOrTwoSidedCongruence, IsList]);
 
 # Algebraic operators
 DeclareOperation("JoinLeftSemigroupCongruences",
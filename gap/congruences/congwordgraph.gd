@@ -18,4 +18,5 @@ DeclareCategory("IsCongruenceByWordGraph",
 
 DeclareOperation("RightCongruenceByWordGraphNC", [IsSemigroup, IsWordGraph]);
 DeclareOperation("LeftCongruenceByWordGraphNC", [IsSemigroup, IsWordGraph]);
+DeclareOperation("CongruenceByWordGraphNC", [IsSemigroup, IsWordGraph]);
 DeclareAttribute("WordGraph", IsCongruenceByWordGraph);
@@ -28,3 +28,10 @@ DeclareOperation("CongruenceReduce",
 DeclareOperation("CongruenceReduce",
                  [CanUseLibsemigroupsCongruence, IsMultiplicativeElement]);
 
+# The next two operations are batch versions of CongruenceReduce and
+# CongruenceTestMembershipNC, which make a single call to libsemigroups for a
+# whole list of words or pairs of words (given as lists of positive integers).
+DeclareOperation("CongruenceReduceMany",
+                 [CanUseLibsemigroupsCongruence, IsList]);
+DeclareOperation("CongruenceTestMembershipManyNC",
+                 [CanUseLibsemigroupsCongruence, IsList]);
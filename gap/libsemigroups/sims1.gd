@@ -36,3 +36,8 @@ DeclareOperation("IteratorOfRightCongruences",
                  [IsSemigroup]);
 DeclareOperation("IteratorOfLeftCongruences",
                  [IsSemigroup]);
+
+DeclareOperation("IteratorOfCongruences",
+                 [IsSemigroup, IsPosInt, IsListOrCollection]);
+DeclareOperation("IteratorOfCongruences", [IsSemigroup, IsPosInt]);
+DeclareOperation("IteratorOfCongruences", [IsSemigroup]);
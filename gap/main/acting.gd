@@ -21,6 +21,8 @@ DeclareOperation("OrbitGraphAsSets", [IsSemigroupData]);
 DeclareOperation("OrbitGraph", [IsSemigroupData]);
 DeclareOperation("PositionOfFound", [IsSemigroupData]);
 
+DeclareOperation("ElementsInSemigroup", [IsSemigroup, IsList]);
+
 # these must be here since SEMIGROUPS.UniversalFakeOne is used in lots of other
 # places
 
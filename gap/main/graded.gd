@@ -24,3 +24,17 @@ DeclareGlobalFunction("IteratorOfGradedLambdaOrbs");
 DeclareAttribute("GradedRhoOrbs", IsActingSemigroup, "mutable");
 DeclareProperty("IsGradedLambdaOrbs", IsOrbit);
 DeclareProperty("IsGradedRhoOrbs", IsOrbit);
+
+# SetGradedOrbsLimit(graded, limit) sets the maximum total length of the
+# graded orbits stored in <graded>, which is GradedLambdaOrbs(S) or
+# GradedRhoOrbs(S), to the positive integer or infinity <limit>. Graded orbits
+# which have not been used recently are removed from <graded> and its hash
+# table, immediately and whenever the limit is exceeded later, and are
+# recomputed if they are required again.
+DeclareGlobalFunction("SetGradedOrbsLimit");
+
+# GradedLambdaOrbsOfColl(S, coll) returns the list of global graded lambda
+# orbits of the elements of <coll>, computing each orbit that is not already
+# stored at most once, and similarly for GradedRhoOrbsOfColl.
+DeclareGlobalFunction("GradedLambdaOrbsOfColl");
+DeclareGlobalFunction("GradedRhoOrbsOfColl");
@@ -0,0 +1,208 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "boolmat.hpp"
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+
+// GAP headers
+#include "gap_all.h"  // for Obj, ELM_PLIST, BLOCKS_BLIST, ...
+
+namespace {
+
+  // Returns the number of rows (= number of columns) of the boolean matrix
+  // <x>.
+  size_t dimension(Obj x) {
+    if (TNUM_OBJ(x) != T_POSOBJ) {
+      ErrorQuit("expected a boolean matrix, found a %s", (Int) TNAM_OBJ(x), 0L);
+    }
+    return LEN_LIST(ELM_PLIST(x, 1));
+  }
+
+  // Returns <x> if every row of <x> is a blist in blist rep, and otherwise a
+  // plain list of the rows of <x> in which any row not in blist rep is
+  // replaced by a copy in blist rep. The rows of <x> are not modified.
+  Obj blist_rows(Obj x, size_t n) {
+    size_t i = 1;
+    while (i <= n && IS_BLIST_REP(ELM_PLIST(x, i))) {
+      ++i;
+    }
+    if (i > n) {
+      return x;
+    }
+    Obj out = NEW_PLIST(T_PLIST, n);
+    SET_LEN_PLIST(out, n);
+    for (i = 1; i <= n; ++i) {
+      Obj row = ELM_PLIST(x, i);
+      if (!IS_BLIST_REP(row)) {
+        Obj copy = NewBag(T_BLIST, SIZE_PLEN_BLIST(n));
+        SET_LEN_BLIST(copy, n);
+        for (size_t j = 1; j <= n; ++j) {
+          if (ELM_LIST(row, j) == True) {
+            SET_BIT_BLIST(copy, j);
+          }
+        }
+        row = copy;
+      }
+      SET_ELM_PLIST(out, i, row);
+      CHANGED_BAG(out);
+    }
+    return out;
+  }
+
+  inline size_t number_blocks(size_t n) {
+    return (n + BIPEB - 1) / BIPEB;
+  }
+
+  // Returns the mask of the bits in the last block of a blist of length <n>
+  // that correspond to entries of the blist.
+  inline UInt last_block_mask(size_t n) {
+    return (n % BIPEB == 0 ? ~UInt(0) : (UInt(1) << (n % BIPEB)) - 1);
+  }
+
+  inline bool test_bit(UInt const* blocks, size_t j) {
+    return (blocks[j / BIPEB] >> (j % BIPEB)) & 1;
+  }
+}  // namespace
+
+// Row <i> of <x> * <y> is the union of the rows <k> of <y> such that <x>[i][k]
+// is true, and so every row of the product is computed by OR-ing whole blocks.
+Obj BOOLEAN_MAT_PROD(Obj self, Obj x, Obj y) {
+  size_t const n    = std::min(dimension(x), dimension(y));
+  size_t const nb   = number_blocks(n);
+  UInt const   mask = last_block_mask(n);
+  Obj const    type = TYPE_OBJ(x);
+
+  x = blist_rows(x, n);
+  y = blist_rows(y, n);
+
+  Obj out = NEW_PLIST(T_PLIST_TAB_RECT, n);
+  SET_LEN_PLIST(out, n);
+  for (size_t i = 1; i <= n; ++i) {
+    Obj row = NewBag(T_BLIST, SIZE_PLEN_BLIST(n));
+    SET_LEN_BLIST(row, n);
+    SET_ELM_PLIST(out, i, row);
+    CHANGED_BAG(out);
+  }
+
+  // No garbage collections can happen below this point, and so it is safe to
+  // hold on to pointers into the bags.
+  for (size_t i = 1; i <= n; ++i) {
+    UInt const* xi = CONST_BLOCKS_BLIST(ELM_PLIST(x, i));
+    UInt*       ri = BLOCKS_BLIST(ELM_PLIST(out, i));
+    for (size_t k = 0; k < n; ++k) {
+      if (test_bit(xi, k)) {
+        UInt const* yk = CONST_BLOCKS_BLIST(ELM_PLIST(y, k + 1));
+        for (size_t b = 0; b < nb; ++b) {
+          ri[b] |= yk[b];
+        }
+      }
+    }
+    if (nb > 0) {
+      ri[nb - 1] &= mask;
+    }
+  }
+
+  for (size_t i = 1; i <= n; ++i) {
+    MakeImmutable(ELM_PLIST(out, i));
+  }
+  SET_TYPE_POSOBJ(out, type);
+  RetypeBag(out, T_POSOBJ);
+  CHANGED_BAG(out);
+  return out;
+}
+
+Obj BOOLEAN_MAT_EQ(Obj self, Obj x, Obj y) {
+  size_t const n = dimension(x);
+  if (dimension(y) != n) {
+    return False;
+  }
+  size_t const nb   = number_blocks(n);
+  UInt const   mask = last_block_mask(n);
+
+  x = blist_rows(x, n);
+  y = blist_rows(y, n);
+
+  for (size_t i = 1; i <= n; ++i) {
+    UInt const* xi = CONST_BLOCKS_BLIST(ELM_PLIST(x, i));
+    UInt const* yi = CONST_BLOCKS_BLIST(ELM_PLIST(y, i));
+    for (size_t b = 0; b < nb; ++b) {
+      UInt const m = (b == nb - 1 ? mask : ~UInt(0));
+      if ((xi[b] & m) != (yi[b] & m)) {
+        return False;
+      }
+    }
+  }
+  return True;
+}
+
+// Matrices of smaller dimension are smaller, and matrices of equal dimension
+// are compared row by row, where the rows are compared as blists in GAP, i.e.
+// lexicographically with true < false. Hence <x> < <y> if the first entry
+// where <x> and <y> differ is true in <y>.
+Obj BOOLEAN_MAT_LT(Obj self, Obj x, Obj y) {
+  size_t const n = dimension(x);
+  size_t const m = dimension(y);
+  if (n != m) {
+    return (n < m ? True : False);
+  }
+  size_t const nb   = number_blocks(n);
+  UInt const   mask = last_block_mask(n);
+
+  x = blist_rows(x, n);
+  y = blist_rows(y, n);
+
+  for (size_t i = 1; i <= n; ++i) {
+    UInt const* xi = CONST_BLOCKS_BLIST(ELM_PLIST(x, i));
+    UInt const* yi = CONST_BLOCKS_BLIST(ELM_PLIST(y, i));
+    for (size_t b = 0; b < nb; ++b) {
+      UInt d = (xi[b] ^ yi[b]) & (b == nb - 1 ? mask : ~UInt(0));
+      if (d != 0) {
+        // The lowest set bit of d is the first position where the rows differ
+        d &= ~d + 1;
+        return ((yi[b] & d) != 0 ? True : False);
+      }
+    }
+  }
+  return False;
+}
+
+// This is the same hash value as that computed by the GAP function which this
+// replaced: the entries of <x> in row-major order, read as a binary number,
+// modulo <data>, plus 1.
+Obj BOOLEAN_MAT_HASH(Obj self, Obj x, Obj data) {
+  if (!IS_POS_INTOBJ(data)) {
+    ErrorQuit("the 2nd argument must be a positive small integer, found a %s",
+              (Int) TNAM_OBJ(data),
+              0L);
+  }
+  size_t const n   = dimension(x);
+  UInt const   mod = INT_INTOBJ(data);
+  UInt         h   = 0;
+
+  x = blist_rows(x, n);
+
+  for (size_t i = 1; i <= n; ++i) {
+    UInt const* xi = CONST_BLOCKS_BLIST(ELM_PLIST(x, i));
+    for (size_t j = 0; j < n; ++j) {
+      h = ((h << 1) + (test_bit(xi, j) ? 1 : 0)) % mod;
+    }
+  }
+  return INTOBJ_INT(h + 1);
+}
@@ -0,0 +1,34 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains declarations of kernel functions for the boolean matrices
+// in gap/elements/boolmat.gi, i.e. positional objects whose rows are blists in
+// blist rep. The functions operate on the blocks of the rows a machine word at
+// a time.
+
+#ifndef SEMIGROUPS_SRC_BOOLMAT_HPP_
+#define SEMIGROUPS_SRC_BOOLMAT_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj BOOLEAN_MAT_PROD(Obj self, Obj x, Obj y);
+Obj BOOLEAN_MAT_EQ(Obj self, Obj x, Obj y);
+Obj BOOLEAN_MAT_LT(Obj self, Obj x, Obj y);
+Obj BOOLEAN_MAT_HASH(Obj self, Obj x, Obj data);
+
+#endif  // SEMIGROUPS_SRC_BOOLMAT_HPP_
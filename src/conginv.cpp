@@ -0,0 +1,438 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains a function KERNEL_TRACE_CLOSURE for computing the least
+// congruence pair (kernel and trace) of a finite inverse semigroup containing
+// some given elements in the kernel and some given pairs of idempotents in the
+// trace. See J.M. Howie's "Fundamentals of Semigroup Theory" Section 5.3.
+//
+// The semigroup is represented by its left and right Cayley graphs, with
+// respect to a generating set, the inverse of every element is computed from
+// these using a spanning tree of the right Cayley graph. Congruence pairs are
+// in order preserving bijection with congruences, and an element x belongs to
+// the kernel of a congruence if and only if x is related to x ^ -1 x. Hence
+// the least congruence pair is that of the least congruence containing the
+// pairs (x, x ^ -1 x) for the given kernel elements x, and the given pairs of
+// idempotents. This congruence is found using a union-find on the elements,
+// closing under left and right multiplication by the generators via the
+// Cayley graphs, so that every merge of two classes costs a constant number
+// of steps per generator.
+
+#include "conginv.hpp"
+
+#include <algorithm>  // for reverse
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <numeric>    // for iota
+#include <utility>    // for pair
+#include <vector>     // for vector
+
+// GAP headers
+#include "gap_all.h"
+
+// Semigroups package for GAP headers
+#include "semigroups-debug.hpp"  // for SEMIGROUPS_ASSERT
+
+namespace semigroups {
+  namespace {
+    using index_type = uint32_t;
+    using word_type  = std::vector<index_type>;
+
+    constexpr index_type UNDEFINED = static_cast<index_type>(-1);
+
+    // The representative of every class is its least element.
+    class UF {
+      std::vector<index_type> _data;
+
+     public:
+      explicit UF(size_t n) : _data(n) {
+        std::iota(_data.begin(), _data.end(), 0);
+      }
+
+      index_type find(index_type x) {
+        SEMIGROUPS_ASSERT(x < _data.size());
+        while (_data[x] != x) {
+          _data[x] = _data[_data[x]];
+          x        = _data[x];
+        }
+        return x;
+      }
+
+      // Returns true if x and y were not already in the same class.
+      bool unite(index_type x, index_type y) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+          return false;
+        } else if (x < y) {
+          _data[y] = x;
+        } else {
+          _data[x] = y;
+        }
+        return true;
+      }
+
+      size_t size() const noexcept {
+        return _data.size();
+      }
+    };
+
+    // Returns the 0-based version of a GAP list of positive integers.
+    std::vector<index_type> to_indices(Obj list) {
+      SEMIGROUPS_ASSERT(IS_LIST(list));
+      size_t const            n = LEN_LIST(list);
+      std::vector<index_type> out;
+      out.reserve(n);
+      for (size_t i = 1; i <= n; ++i) {
+        SEMIGROUPS_ASSERT(IS_INTOBJ(ELM_LIST(list, i)));
+        out.push_back(INT_INTOBJ(ELM_LIST(list, i)) - 1);
+      }
+      return out;
+    }
+
+    // Returns a GAP list containing the 1-based versions of the values in
+    // [first, last).
+    template <typename Iterator>
+    Obj to_gap_list(Iterator first, Iterator last) {
+      Obj out = NEW_PLIST(first == last ? T_PLIST_EMPTY : T_PLIST_CYC,
+                          last - first);
+      SET_LEN_PLIST(out, last - first);
+      for (size_t i = 1; first != last; ++first, ++i) {
+        SET_ELM_PLIST(out, i, INTOBJ_INT(*first + 1));
+      }
+      return out;
+    }
+
+    class InverseSemigroupData {
+      size_t                  _nr_gens;
+      std::vector<index_type> _inverse;
+      std::vector<word_type>  _inverse_gen_words;
+      std::vector<index_type> _left;
+      std::vector<index_type> _letter;
+      std::vector<index_type> _parent;
+      std::vector<index_type> _right;
+      std::vector<index_type> _right_one;
+
+      static std::vector<index_type> cayley_graph(Obj graph, size_t nr_gens) {
+        size_t const            n = LEN_LIST(graph);
+        std::vector<index_type> out;
+        out.reserve(n * nr_gens);
+        for (size_t i = 1; i <= n; ++i) {
+          Obj row = ELM_LIST(graph, i);
+          SEMIGROUPS_ASSERT(LEN_LIST(row) == nr_gens);
+          for (size_t a = 1; a <= nr_gens; ++a) {
+            out.push_back(INT_INTOBJ(ELM_LIST(row, a)) - 1);
+          }
+        }
+        return out;
+      }
+
+     public:
+      InverseSemigroupData(Obj right, Obj left, Obj gens, Obj invs)
+          : _nr_gens(LEN_LIST(gens)),
+            _inverse(LEN_LIST(right), UNDEFINED),
+            _inverse_gen_words(),
+            _left(cayley_graph(left, _nr_gens)),
+            _letter(LEN_LIST(right), UNDEFINED),
+            _parent(LEN_LIST(right), UNDEFINED),
+            _right(cayley_graph(right, _nr_gens)),
+            _right_one(LEN_LIST(right), UNDEFINED) {
+        auto gen_pos = to_indices(gens);
+        auto inv_pos = to_indices(invs);
+        SEMIGROUPS_ASSERT(inv_pos.size() == _nr_gens);
+
+        // Spanning tree of the right Cayley graph, in breadth first order
+        std::vector<index_type> order;
+        order.reserve(size());
+        for (index_type a = 0; a < _nr_gens; ++a) {
+          if (_letter[gen_pos[a]] == UNDEFINED) {
+            _letter[gen_pos[a]] = a;
+            order.push_back(gen_pos[a]);
+          }
+        }
+        for (size_t i = 0; i < order.size(); ++i) {
+          for (index_type a = 0; a < _nr_gens; ++a) {
+            index_type y = right(order[i], a);
+            if (_letter[y] == UNDEFINED) {
+              _parent[y] = order[i];
+              _letter[y] = a;
+              order.push_back(y);
+            }
+          }
+        }
+        SEMIGROUPS_ASSERT(order.size() == size());
+
+        _inverse_gen_words.reserve(_nr_gens);
+        for (index_type a = 0; a < _nr_gens; ++a) {
+          _inverse_gen_words.push_back(word(inv_pos[a]));
+        }
+
+        // If x = pa, then x ^ -1 = a ^ -1 p ^ -1 and x ^ -1 x = a ^ -1 (p ^ -1
+        // p) a.
+        for (index_type x : order) {
+          index_type a = _letter[x];
+          index_type p = _parent[x];
+          if (p == UNDEFINED) {
+            _inverse[x]   = inv_pos[a];
+            _right_one[x] = right(inv_pos[a], a);
+          } else {
+            _inverse[x]   = left_product(_inverse_gen_words[a], _inverse[p]);
+            _right_one[x] = conjugate(_right_one[p], a);
+          }
+        }
+      }
+
+      size_t size() const noexcept {
+        return _right_one.size();
+      }
+
+      size_t number_of_generators() const noexcept {
+        return _nr_gens;
+      }
+
+      // x * a
+      index_type right(index_type x, index_type a) const {
+        return _right[x * _nr_gens + a];
+      }
+
+      // a * x
+      index_type left(index_type x, index_type a) const {
+        return _left[x * _nr_gens + a];
+      }
+
+      index_type inverse(index_type x) const {
+        return _inverse[x];
+      }
+
+      // x ^ -1 * x
+      index_type right_one(index_type x) const {
+        return _right_one[x];
+      }
+
+      // x * x ^ -1
+      index_type left_one(index_type x) const {
+        return _right_one[_inverse[x]];
+      }
+
+      bool is_idempotent(index_type x) const {
+        return _right_one[x] == x;
+      }
+
+      word_type word(index_type x) const {
+        word_type w;
+        while (_parent[x] != UNDEFINED) {
+          w.push_back(_letter[x]);
+          x = _parent[x];
+        }
+        w.push_back(_letter[x]);
+        std::reverse(w.begin(), w.end());
+        return w;
+      }
+
+      // x * w
+      index_type product(index_type x, word_type const& w) const {
+        for (index_type a : w) {
+          x = right(x, a);
+        }
+        return x;
+      }
+
+      // w * x
+      index_type left_product(word_type const& w, index_type x) const {
+        for (auto it = w.crbegin(); it != w.crend(); ++it) {
+          x = left(x, *it);
+        }
+        return x;
+      }
+
+      // a ^ -1 * x * a
+      index_type conjugate(index_type x, index_type a) const {
+        return right(left_product(_inverse_gen_words[a], x), a);
+      }
+    };
+
+    class KernelTraceClosure {
+      InverseSemigroupData const& _S;
+
+      UF                                             _classes;
+      size_t                                         _next_pair;
+      std::vector<std::pair<index_type, index_type>> _pairs;
+
+      void add_pair(index_type x, index_type y) {
+        if (_classes.unite(x, y)) {
+          _pairs.emplace_back(x, y);
+        }
+      }
+
+      bool in_kernel(index_type x) {
+        return _classes.find(x) == _classes.find(_S.right_one(x));
+      }
+
+     public:
+      explicit KernelTraceClosure(InverseSemigroupData const& S)
+          : _S(S), _classes(S.size()), _next_pair(0), _pairs() {}
+
+      void add_generators(std::vector<index_type> const& gens) {
+        for (index_type x : gens) {
+          add_pair(x, _S.right_one(x));
+        }
+      }
+
+      void add_pairs(std::vector<index_type> const& pairs) {
+        SEMIGROUPS_ASSERT(pairs.size() % 2 == 0);
+        for (size_t i = 0; i < pairs.size(); i += 2) {
+          SEMIGROUPS_ASSERT(_S.is_idempotent(pairs[i]));
+          SEMIGROUPS_ASSERT(_S.is_idempotent(pairs[i + 1]));
+          add_pair(pairs[i], pairs[i + 1]);
+        }
+      }
+
+      // Every pair in _pairs joined two distinct classes, and so there are
+      // fewer than size() of them.
+      void run() {
+        for (; _next_pair < _pairs.size(); ++_next_pair) {
+          index_type const x = _pairs[_next_pair].first;
+          index_type const y = _pairs[_next_pair].second;
+          for (index_type a = 0; a < _S.number_of_generators(); ++a) {
+            add_pair(_S.right(x, a), _S.right(y, a));
+            add_pair(_S.left(x, a), _S.left(y, a));
+          }
+        }
+      }
+
+      Obj kernel() {
+        size_t const n   = _S.size();
+        Obj          out = NewBag(T_BLIST, SIZE_PLEN_BLIST(n));
+        SET_LEN_BLIST(out, n);
+        for (index_type x = 0; x < n; ++x) {
+          if (in_kernel(x)) {
+            SET_BIT_BLIST(out, x + 1);
+          }
+        }
+        return out;
+      }
+
+      size_t kernel_size() {
+        size_t out = 0;
+        for (index_type x = 0; x < _S.size(); ++x) {
+          out += in_kernel(x);
+        }
+        return out;
+      }
+
+      // Returns non-idempotent elements of the kernel which, together with
+      // the idempotents, generate the kernel as an inverse semigroup. The
+      // elements are chosen greedily; the inverse subsemigroup generated by
+      // the idempotents and the chosen elements x_1, ..., x_k consists of the
+      // idempotents and their products with words in the x_i and x_i ^ -1,
+      // since xe = (xex ^ -1)x, and these are found by right multiplication.
+      Obj generators() {
+        size_t const            n = _S.size();
+        std::vector<index_type> gens;
+        std::vector<word_type>  words;
+        std::vector<bool>       seen(n, false);
+        std::vector<index_type> sub;
+        std::vector<size_t>     nr_words_applied;
+
+        for (index_type x = 0; x < n; ++x) {
+          if (_S.is_idempotent(x)) {
+            seen[x] = true;
+            sub.push_back(x);
+            nr_words_applied.push_back(0);
+          }
+        }
+
+        for (index_type x = 0; x < n; ++x) {
+          if (seen[x] || !in_kernel(x)) {
+            continue;
+          }
+          gens.push_back(x);
+          words.push_back(_S.word(x));
+          if (_S.inverse(x) != x) {
+            words.push_back(_S.word(_S.inverse(x)));
+          }
+          for (size_t i = 0; i < sub.size(); ++i) {
+            for (size_t j = nr_words_applied[i]; j < words.size(); ++j) {
+              index_type const y = _S.product(sub[i], words[j]);
+              if (!seen[y]) {
+                seen[y] = true;
+                sub.push_back(y);
+                nr_words_applied.push_back(0);
+              }
+            }
+            nr_words_applied[i] = words.size();
+          }
+          SEMIGROUPS_ASSERT(seen[x]);
+        }
+        return to_gap_list(gens.cbegin(), gens.cend());
+      }
+
+      Obj trace() {
+        std::vector<std::vector<index_type>> blocks(_S.size());
+        for (index_type x = 0; x < _S.size(); ++x) {
+          if (_S.is_idempotent(x)) {
+            blocks[_classes.find(x)].push_back(x);
+          }
+        }
+        Obj out = NEW_PLIST(T_PLIST, 0);
+        for (auto const& block : blocks) {
+          if (!block.empty()) {
+            PushPlist(out, to_gap_list(block.cbegin(), block.cend()));
+          }
+        }
+        return out;
+      }
+    };
+  }  // namespace
+
+  Obj KERNEL_TRACE_CLOSURE(Obj right,
+                           Obj left,
+                           Obj gens,
+                           Obj invs,
+                           Obj kernel,
+                           Obj pairs) {
+    if (LEN_LIST(right) != LEN_LIST(left)) {
+      ErrorQuit("the 1st and 2nd arguments (Cayley graphs) must have equal "
+                "length, found %d and %d",
+                (Int) LEN_LIST(right),
+                (Int) LEN_LIST(left));
+    } else if (LEN_LIST(gens) != LEN_LIST(invs)) {
+      ErrorQuit("the 3rd and 4th arguments (lists) must have equal length, "
+                "found %d and %d",
+                (Int) LEN_LIST(gens),
+                (Int) LEN_LIST(invs));
+    } else if (LEN_LIST(pairs) % 2 != 0) {
+      ErrorQuit("the 6th argument (a list) must have even length, found %d",
+                (Int) LEN_LIST(pairs),
+                0L);
+    }
+
+    InverseSemigroupData S(right, left, gens, invs);
+    KernelTraceClosure   closure(S);
+    closure.add_generators(to_indices(kernel));
+    closure.add_pairs(to_indices(pairs));
+    closure.run();
+
+    Obj out = NEW_PREC(4);
+    AssPRec(out, RNamName("kernel"), closure.kernel());
+    AssPRec(out, RNamName("gens"), closure.generators());
+    AssPRec(out, RNamName("size"), INTOBJ_INT(closure.kernel_size()));
+    AssPRec(out, RNamName("trace"), closure.trace());
+    return out;
+  }
+}  // namespace semigroups
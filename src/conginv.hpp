@@ -0,0 +1,37 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains the declaration of a function for computing the least
+// congruence pair (kernel and trace) of an inverse semigroup containing some
+// given data.
+
+#ifndef SEMIGROUPS_SRC_CONGINV_HPP_
+#define SEMIGROUPS_SRC_CONGINV_HPP_
+
+#include "gap_all.h"  // for Obj
+
+namespace semigroups {
+  Obj KERNEL_TRACE_CLOSURE(Obj right,
+                           Obj left,
+                           Obj gens,
+                           Obj invs,
+                           Obj kernel,
+                           Obj pairs);
+}
+
+#endif  // SEMIGROUPS_SRC_CONGINV_HPP_
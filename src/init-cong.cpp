@@ -83,6 +83,22 @@ using libsemigroups::Congruence;
 using libsemigroups::Presentation;
 using libsemigroups::word_type;
 
+using KnuthBendix = libsemigroups::KnuthBendix<word_type>;
+using ToddCoxeter = libsemigroups::ToddCoxeter<word_type>;
+
+namespace {
+  // Returns the runner of type Thing used by the Congruence <self>, so that
+  // its settings can be changed before <self> is run.
+  template <typename Thing>
+  Thing& runner(Congruence<word_type>& self) {
+    if (!self.has<Thing>()) {
+      throw std::runtime_error(
+          "the congruence does not use the requested algorithm");
+    }
+    return *self.get<Thing>();
+  }
+}  // namespace
+
 void init_cong(gapbind14::Module& m) {
   gapbind14::class_<Congruence<word_type>>("Congruence")
       .def(gapbind14::init<congruence_kind, Presentation<word_type>>{}, "make")
@@ -103,15 +119,114 @@ void init_cong(gapbind14::Module& m) {
              self.run_for(std::chrono::milliseconds(10));
              return libsemigroups::congruence::contains(self, u, v);
            })
-      .def("reduce", [](Congruence<word_type>& self, word_type const& u) {
-        return libsemigroups::congruence::reduce(self, u);
-      });
+      .def("contains_many",
+           [](Congruence<word_type>&                     self,
+              std::vector<std::vector<word_type>> const& pairs) {
+             size_t const n = pairs.size();
+             for (size_t i = 0; i < n; ++i) {
+               if (pairs[i].size() != 2) {
+                 throw std::runtime_error(
+                     "expected a list of pairs of words, found an item of "
+                     "length "
+                     + std::to_string(pairs[i].size()) + " in position "
+                     + std::to_string(i + 1));
+               }
+               for (auto const& w : pairs[i]) {
+                 self.throw_if_letter_not_in_alphabet(w.cbegin(), w.cend());
+               }
+             }
+             // Run once, and then answer every pair from the finished
+             // congruence, like reduce_many.
+             self.run();
+             Obj result = NewBag(T_BLIST, SIZE_PLEN_BLIST(n));
+             SET_LEN_BLIST(result, n);
+             for (size_t i = 0; i < n; ++i) {
+               if (libsemigroups::congruence::contains_no_checks(
+                       self, pairs[i][0], pairs[i][1])) {
+                 SET_BIT_BLIST(result, i + 1);
+               }
+             }
+             return result;
+           })
+      .def("has_todd_coxeter",
+           [](Congruence<word_type>& self) {
+             return self.has<ToddCoxeter>();
+           })
+      .def("todd_coxeter_strategy",
+           [](Congruence<word_type>&           self,
+              ToddCoxeter::options::strategy val) {
+             runner<ToddCoxeter>(self).strategy(val);
+           })
+      .def("todd_coxeter_lookahead_extent",
+           [](Congruence<word_type>&                   self,
+              ToddCoxeter::options::lookahead_extent val) {
+             runner<ToddCoxeter>(self).lookahead_extent(val);
+           })
+      .def("todd_coxeter_lookahead_style",
+           [](Congruence<word_type>&                  self,
+              ToddCoxeter::options::lookahead_style val) {
+             runner<ToddCoxeter>(self).lookahead_style(val);
+           })
+      .def("todd_coxeter_lookahead_next",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<ToddCoxeter>(self).lookahead_next(val);
+           })
+      .def("todd_coxeter_lookahead_min",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<ToddCoxeter>(self).lookahead_min(val);
+           })
+      .def("todd_coxeter_def_max",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<ToddCoxeter>(self).def_max(val);
+           })
+      .def("todd_coxeter_def_policy",
+           [](Congruence<word_type>&             self,
+              ToddCoxeter::options::def_policy val) {
+             runner<ToddCoxeter>(self).def_policy(val);
+           })
+      .def("todd_coxeter_large_collapse",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<ToddCoxeter>(self).large_collapse(val);
+           })
+      .def("todd_coxeter_save",
+           [](Congruence<word_type>& self, bool val) {
+             runner<ToddCoxeter>(self).save(val);
+           })
+      .def("has_knuth_bendix",
+           [](Congruence<word_type>& self) {
+             return self.has<KnuthBendix>();
+           })
+      .def("knuth_bendix_max_rules",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<KnuthBendix>(self).max_rules(val);
+           })
+      .def("knuth_bendix_overlap_policy",
+           [](Congruence<word_type>& self, KnuthBendix::options::overlap val) {
+             runner<KnuthBendix>(self).overlap_policy(val);
+           })
+      .def("knuth_bendix_max_overlap",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<KnuthBendix>(self).max_overlap(val);
+           })
+      .def("knuth_bendix_check_confluence_interval",
+           [](Congruence<word_type>& self, size_t val) {
+             runner<KnuthBendix>(self).check_confluence_interval(val);
+           })
+      .def("reduce",
+           [](Congruence<word_type>& self, word_type const& u) {
+             return libsemigroups::congruence::reduce(self, u);
+           })
+      .def("reduce_many",
+           [](Congruence<word_type>& self, std::vector<word_type> words) {
+             self.run();
+             for (auto& w : words) {
+               w = libsemigroups::congruence::reduce_no_run(self, w);
+             }
+             return words;
+           });
 
   gapbind14::InstallGlobalFunction(
       "congruence_normal_forms", [](Congruence<word_type>& c) {
-        using ToddCoxeter = libsemigroups::ToddCoxeter<word_type>;
-        using KnuthBendix = libsemigroups::KnuthBendix<word_type>;
-
         c.run();
         if (c.has<ToddCoxeter>() && c.get<ToddCoxeter>()->finished()) {
           auto nf = libsemigroups::todd_coxeter::normal_forms(
@@ -137,8 +252,7 @@ void init_cong(gapbind14::Module& m) {
       "infinite_congruence_non_trivial_classes",
       [](Congruence<word_type>& super, Congruence<word_type>& sub) {
         auto ntc = libsemigroups::knuth_bendix::non_trivial_classes(
-            *super.get<libsemigroups::KnuthBendix<word_type>>(),
-            *sub.get<libsemigroups::KnuthBendix<word_type>>());
+            *super.get<KnuthBendix>(), *sub.get<KnuthBendix>());
         return gapbind14::make_iterator(ntc.begin(), ntc.end());
       });
 }
@@ -0,0 +1,569 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains functions for reading and writing binary generators
+// files, which are used by ReadGenerators, WriteGenerators, and
+// IteratorFromGeneratorsFile in gap/tools/io.gi.
+//
+// A binary generators file consists of:
+//
+// * a header of 32 bytes: the magic bytes GENS_FILE_MAGIC, the version
+//   (uint32_t), the byte order mark GENS_FILE_BOM (uint32_t), the number of
+//   entries (uint64_t), and the offset of the index (uint64_t);
+// * the entries, one after another;
+// * the index, which consists of the offset of every entry (uint64_t).
+//
+// Appending to a file writes the new entries and then a new index after the
+// old index, which is left in place, unused, between the old and the new
+// entries.
+//
+// Every entry consists of its kind (one of 't', 'p', 'b', or 'm' for
+// transformations, partial perms, bipartitions, and boolean matrices), the
+// width in bytes of its values (1, 2, or 4), 2 bytes of padding, and the
+// number of generators (uint32_t). Every generator consists of its length
+// (uint32_t), followed by that many values of the given width: the images of
+// 1, 2, ..., n for transformations and partial perms (0 for undefined), and
+// IntRepOfBipartition for bipartitions. For boolean matrices the length is
+// the dimension n, and it is followed by the n ^ 2 entries of the matrix
+// packed into bits, row by row.
+//
+// All integers are stored in the byte order of the machine writing the file,
+// files written on a machine with a different byte order are rejected.
+
+#include "init-generators-file.hpp"
+
+#include <fcntl.h>     // for open, O_RDONLY, O_RDWR
+#include <stdlib.h>    // for mkstemp
+#include <sys/mman.h>  // for mmap, munmap
+#include <sys/stat.h>  // for fstat, fchmod, umask
+#include <unistd.h>    // for close, fsync, pread, pwrite, unlink
+
+#include <cerrno>       // for errno, EINTR, ENOENT
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstdio>       // for rename
+#include <cstring>      // for memcmp, memcpy
+#include <fstream>      // for ifstream
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string
+#include <type_traits>  // for true_type
+#include <vector>       // for vector
+
+// GAP headers
+#include "gap_all.h"
+
+// Semigroups pkg headers
+#include "pkg.hpp"  // for IsGapBind14Type
+
+// GapBind14 headers
+#include "gapbind14/gapbind14.hpp"  // for class_ etc
+
+namespace semigroups {
+
+  namespace {
+    constexpr char GENS_FILE_MAGIC[8]
+        = {'\211', 'S', 'G', 'E', 'N', 'S', '\r', '\n'};
+    constexpr uint32_t GENS_FILE_VERSION = 1;
+    constexpr uint32_t GENS_FILE_BOM     = 0x01020304;
+
+    struct GensFileHeader {
+      char     magic[8];
+      uint32_t version;
+      uint32_t bom;
+      uint64_t nr_entries;
+      uint64_t index_offset;
+    };
+
+    static_assert(sizeof(GensFileHeader) == 32,
+                  "the header of a generators file must be 32 bytes");
+
+    bool is_valid_header(GensFileHeader const& header) {
+      return std::memcmp(header.magic, GENS_FILE_MAGIC, 8) == 0
+             && header.version == GENS_FILE_VERSION
+             && header.bom == GENS_FILE_BOM;
+    }
+
+    template <typename T>
+    T load(uint8_t const* ptr) {
+      T val;
+      std::memcpy(&val, ptr, sizeof(T));
+      return val;
+    }
+
+    template <typename T>
+    void store(std::vector<uint8_t>& buf, T val) {
+      size_t pos = buf.size();
+      buf.resize(pos + sizeof(T));
+      std::memcpy(buf.data() + pos, &val, sizeof(T));
+    }
+
+    uint32_t int_value(Obj val) {
+      if (!IS_INTOBJ(val) || INT_INTOBJ(val) < 0
+          || static_cast<UInt>(INT_INTOBJ(val)) > UINT32_MAX) {
+        throw std::runtime_error(
+            "expected a non-negative integer less than 2 ^ 32, found "
+            + std::string(TNAM_OBJ(val)));
+      }
+      return static_cast<uint32_t>(INT_INTOBJ(val));
+    }
+
+    // Appends the entry <entry> = [kind, gens] to <buf>, where kind is one
+    // of the characters 't', 'p', 'b', 'm', and gens is a list of lists of
+    // integers, or of lists of boolean lists if kind is 'm'.
+    void encode_entry(std::vector<uint8_t>& buf, Obj entry) {
+      if (!IS_LIST(entry) || LEN_LIST(entry) != 2
+          || TNUM_OBJ(ELM_LIST(entry, 1)) != T_CHAR
+          || !IS_LIST(ELM_LIST(entry, 2))) {
+        throw std::runtime_error("expected a list [kind, generators]");
+      }
+      char kind = static_cast<char>(CHAR_VALUE(ELM_LIST(entry, 1)));
+      if (kind != 't' && kind != 'p' && kind != 'b' && kind != 'm') {
+        throw std::runtime_error(std::string("unknown kind of entry '") + kind
+                                 + "'");
+      }
+      Obj  gens  = ELM_LIST(entry, 2);
+      UInt nr    = LEN_LIST(gens);
+      UInt width = 1;
+      if (kind != 'm') {
+        uint32_t max = 0;
+        for (UInt i = 1; i <= nr; ++i) {
+          Obj x = ELM_LIST(gens, i);
+          for (UInt j = 1; j <= static_cast<UInt>(LEN_LIST(x)); ++j) {
+            uint32_t val = int_value(ELM_LIST(x, j));
+            max          = (val > max ? val : max);
+          }
+        }
+        width = (max <= UINT8_MAX ? 1 : (max <= UINT16_MAX ? 2 : 4));
+      }
+      store<uint8_t>(buf, kind);
+      store<uint8_t>(buf, width);
+      store<uint16_t>(buf, 0);
+      store<uint32_t>(buf, nr);
+
+      for (UInt i = 1; i <= nr; ++i) {
+        Obj  x   = ELM_LIST(gens, i);
+        UInt len = LEN_LIST(x);
+        store<uint32_t>(buf, len);
+        if (kind == 'm') {
+          std::vector<uint8_t> bits((len * len + 7) / 8, 0);
+          for (UInt r = 1; r <= len; ++r) {
+            Obj row = ELM_LIST(x, r);
+            if (!IS_LIST(row) || static_cast<UInt>(LEN_LIST(row)) != len) {
+              throw std::runtime_error("expected a square boolean matrix");
+            }
+            for (UInt c = 1; c <= len; ++c) {
+              if (ELM_LIST(row, c) == True) {
+                UInt k = (r - 1) * len + c - 1;
+                bits[k / 8] |= static_cast<uint8_t>(1 << (k % 8));
+              }
+            }
+          }
+          buf.insert(buf.end(), bits.begin(), bits.end());
+        } else {
+          for (UInt j = 1; j <= len; ++j) {
+            uint32_t val = int_value(ELM_LIST(x, j));
+            if (width == 1) {
+              store<uint8_t>(buf, val);
+            } else if (width == 2) {
+              store<uint16_t>(buf, val);
+            } else {
+              store<uint32_t>(buf, val);
+            }
+          }
+        }
+      }
+    }
+  }  // namespace
+
+  // Returns true if the file <name> exists and starts with the magic bytes of
+  // a binary generators file.
+  bool is_generators_file(std::string const& name) {
+    std::ifstream in(name, std::ios::binary);
+    char          magic[8];
+    in.read(magic, 8);
+    return in.gcount() == 8 && std::memcmp(magic, GENS_FILE_MAGIC, 8) == 0;
+  }
+
+  namespace {
+    // Writes the <n> bytes at <data> to <fd> starting at <offset>, throwing
+    // if any of them cannot be written.
+    void write_at(int                fd,
+                  void const*        data,
+                  size_t             n,
+                  uint64_t           offset,
+                  std::string const& name) {
+      auto ptr = static_cast<char const*>(data);
+      while (n > 0) {
+        ssize_t k = pwrite(fd, ptr, n, offset);
+        if (k == -1 && errno == EINTR) {
+          continue;
+        } else if (k <= 0) {
+          throw std::runtime_error("couldn't write to the file " + name);
+        }
+        ptr += k;
+        n -= k;
+        offset += k;
+      }
+    }
+
+    // Reads <n> bytes from <fd> starting at <offset> into <data>, throwing if
+    // there are fewer than <n> bytes to read.
+    void read_at(int                fd,
+                 void*              data,
+                 size_t             n,
+                 uint64_t           offset,
+                 std::string const& name) {
+      auto ptr = static_cast<char*>(data);
+      while (n > 0) {
+        ssize_t k = pread(fd, ptr, n, offset);
+        if (k == -1 && errno == EINTR) {
+          continue;
+        } else if (k <= 0) {
+          throw std::runtime_error("the file " + name + " is corrupt");
+        }
+        ptr += k;
+        n -= k;
+        offset += k;
+      }
+    }
+
+    // A file descriptor which is closed when it goes out of scope.
+    class FileDescriptor {
+     public:
+      explicit FileDescriptor(int fd) : _fd(fd) {}
+
+      FileDescriptor(FileDescriptor const&)            = delete;
+      FileDescriptor& operator=(FileDescriptor const&) = delete;
+
+      ~FileDescriptor() {
+        if (_fd != -1) {
+          ::close(_fd);
+        }
+      }
+
+      int get() const noexcept {
+        return _fd;
+      }
+
+      // Closes the file descriptor, returning false if this fails, which may
+      // mean that previous writes failed.
+      bool close() {
+        int fd = _fd;
+        _fd    = -1;
+        return ::close(fd) == 0;
+      }
+
+     private:
+      int _fd;
+    };
+  }  // namespace
+
+  namespace {
+    // Writes the header <header>, the encoded entries <buf> starting at the
+    // offsets <offsets> in <buf>, and then the index, to a new temporary file
+    // in the same directory as <name>, which is then renamed to <name>. So if
+    // anything goes wrong, then <name> is left as it was.
+    void write_new_generators_file(std::string const&           name,
+                                   GensFileHeader&              header,
+                                   std::vector<uint8_t> const&  buf,
+                                   std::vector<uint64_t> const& offsets) {
+      mode_t mask = umask(0);
+      umask(mask);
+
+      std::string    tmp = name + ".XXXXXX";
+      FileDescriptor out(mkstemp(&tmp[0]));
+      if (out.get() == -1) {
+        throw std::runtime_error("couldn't open the file " + tmp);
+      }
+      try {
+        std::vector<uint64_t> index;
+        for (uint64_t pos : offsets) {
+          index.push_back(sizeof(header) + pos);
+        }
+        header.nr_entries   = index.size();
+        header.index_offset = sizeof(header) + buf.size();
+        write_at(out.get(), &header, sizeof(header), 0, tmp);
+        write_at(out.get(), buf.data(), buf.size(), sizeof(header), tmp);
+        write_at(out.get(),
+                 index.data(),
+                 index.size() * sizeof(uint64_t),
+                 header.index_offset,
+                 tmp);
+        if (fchmod(out.get(), 0666 & ~mask) == -1 || fsync(out.get()) == -1
+            || !out.close()) {
+          throw std::runtime_error("couldn't write to the file " + tmp);
+        }
+        if (rename(tmp.c_str(), name.c_str()) == -1) {
+          throw std::runtime_error("couldn't rename the file " + tmp + " to "
+                                   + name);
+        }
+      } catch (...) {
+        unlink(tmp.c_str());
+        throw;
+      }
+    }
+  }  // namespace
+
+  // Writes the entries in the GAP list <entries> (see encode_entry) to the
+  // binary generators file <name>, after those already in <name> if <append>
+  // is true and <name> exists.
+  //
+  // A new file is written by write_new_generators_file. When appending, the
+  // new entries and the new index are written after the old index, and the
+  // header is only overwritten once they have been synced to disk. Until
+  // then the old header still describes the old entries and index, which are
+  // never modified. So if anything goes wrong, then <name> still contains its
+  // old entries, and any GeneratorsFile already reading <name> keeps reading
+  // them, without the existing entries ever being copied.
+  void write_generators_file(std::string const& name,
+                             Obj                entries,
+                             bool               append) {
+    if (!IS_LIST(entries)) {
+      throw std::runtime_error("expected a list of entries");
+    }
+    // Encode everything before touching the file system, so that invalid
+    // entries leave nothing behind.
+    std::vector<uint8_t>  buf;
+    std::vector<uint64_t> offsets;
+    for (UInt i = 1; i <= static_cast<UInt>(LEN_LIST(entries)); ++i) {
+      offsets.push_back(buf.size());
+      encode_entry(buf, ELM_LIST(entries, i));
+    }
+
+    GensFileHeader header;
+    std::memcpy(header.magic, GENS_FILE_MAGIC, 8);
+    header.version      = GENS_FILE_VERSION;
+    header.bom          = GENS_FILE_BOM;
+    header.nr_entries   = 0;
+    header.index_offset = sizeof(header);
+
+    FileDescriptor fd(append ? open(name.c_str(), O_RDWR) : -1);
+    if (fd.get() == -1) {
+      if (append && errno != ENOENT) {
+        throw std::runtime_error("couldn't open the file " + name);
+      }
+      write_new_generators_file(name, header, buf, offsets);
+      return;
+    }
+
+    struct stat st;
+    if (fstat(fd.get(), &st) == -1) {
+      throw std::runtime_error("couldn't open the file " + name);
+    }
+    if (static_cast<uint64_t>(st.st_size) >= sizeof(header)) {
+      read_at(fd.get(), &header, sizeof(header), 0, name);
+    }
+    if (static_cast<uint64_t>(st.st_size) < sizeof(header)
+        || !is_valid_header(header)) {
+      throw std::runtime_error("the file " + name
+                               + " is not a binary generators file");
+    }
+    if (header.index_offset < sizeof(header)
+        || header.index_offset > static_cast<uint64_t>(st.st_size)
+        || (st.st_size - header.index_offset) / sizeof(uint64_t)
+               < header.nr_entries) {
+      throw std::runtime_error("the file " + name + " is corrupt");
+    }
+    std::vector<uint64_t> index(header.nr_entries);
+    read_at(fd.get(),
+            index.data(),
+            index.size() * sizeof(uint64_t),
+            header.index_offset,
+            name);
+
+    // Anything after the old index was left by an append that did not
+    // finish, and is overwritten.
+    uint64_t offset
+        = header.index_offset + header.nr_entries * sizeof(uint64_t);
+    for (uint64_t pos : offsets) {
+      index.push_back(offset + pos);
+    }
+    write_at(fd.get(), buf.data(), buf.size(), offset, name);
+    offset += buf.size();
+    write_at(fd.get(),
+             index.data(),
+             index.size() * sizeof(uint64_t),
+             offset,
+             name);
+    if (fsync(fd.get()) == -1) {
+      throw std::runtime_error("couldn't write to the file " + name);
+    }
+    header.nr_entries   = index.size();
+    header.index_offset = offset;
+    write_at(fd.get(), &header, sizeof(header), 0, name);
+    if (fsync(fd.get()) == -1 || !fd.close()) {
+      throw std::runtime_error("couldn't write to the file " + name);
+    }
+  }
+
+  // A read-only view of a binary generators file, which is mapped into
+  // memory, so that any entry can be decoded without reading the preceding
+  // ones.
+  class GeneratorsFile {
+   public:
+    explicit GeneratorsFile(std::string const& name)
+        : _data(nullptr), _header(), _size(0) {
+      int fd = open(name.c_str(), O_RDONLY);
+      if (fd == -1) {
+        throw std::runtime_error("could not open the file " + name);
+      }
+      struct stat st;
+      if (fstat(fd, &st) == -1
+          || static_cast<size_t>(st.st_size) < sizeof(GensFileHeader)) {
+        close(fd);
+        throw std::runtime_error("the file " + name
+                                 + " is not a binary generators file");
+      }
+      _size     = st.st_size;
+      void* ptr = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (ptr == MAP_FAILED) {
+        throw std::runtime_error("could not map the file " + name);
+      }
+      _data = static_cast<uint8_t const*>(ptr);
+      std::memcpy(&_header, _data, sizeof(_header));
+      if (!is_valid_header(_header) || _header.index_offset > _size
+          || (_size - _header.index_offset) / sizeof(uint64_t)
+                 < _header.nr_entries) {
+        munmap(const_cast<uint8_t*>(_data), _size);
+        throw std::runtime_error("the file " + name
+                                 + " is not a binary generators file");
+      }
+    }
+
+    GeneratorsFile(GeneratorsFile const&)            = delete;
+    GeneratorsFile& operator=(GeneratorsFile const&) = delete;
+
+    ~GeneratorsFile() {
+      munmap(const_cast<uint8_t*>(_data), _size);
+    }
+
+    size_t number_of_entries() const noexcept {
+      return _header.nr_entries;
+    }
+
+    // Returns the <i>-th entry (0-based) as a GAP list [kind, gens], where
+    // kind is a character and gens is a list of lists of integers, or of
+    // lists of boolean lists if kind is 'm'.
+    Obj entry(size_t i) const {
+      if (i >= _header.nr_entries) {
+        throw std::runtime_error("the file only has "
+                                 + std::to_string(_header.nr_entries)
+                                 + " entries");
+      }
+      uint8_t const* index = _data + _header.index_offset + i * 8;
+      uint64_t       first = load<uint64_t>(index);
+      uint64_t       last  = (i + 1 == _header.nr_entries
+                                  ? _header.index_offset
+                                  : load<uint64_t>(index + 8));
+      if (first < sizeof(GensFileHeader) || last < first + 8
+          || last > _header.index_offset) {
+        throw std::runtime_error("the file is corrupt");
+      }
+      uint8_t const* ptr   = _data + first;
+      uint8_t const* end   = _data + last;
+      char           kind  = static_cast<char>(ptr[0]);
+      UInt           width = ptr[1];
+      UInt           nr    = load<uint32_t>(ptr + 4);
+      ptr += 8;
+      if (kind != 't' && kind != 'p' && kind != 'b' && kind != 'm') {
+        throw std::runtime_error(std::string("unknown kind of entry '") + kind
+                                 + "', the file is corrupt");
+      }
+
+      Obj gens = NEW_PLIST(nr == 0 ? T_PLIST_EMPTY : T_PLIST_TAB, nr);
+      SET_LEN_PLIST(gens, nr);
+      for (UInt k = 1; k <= nr; ++k) {
+        check_bounds(ptr, end, 4);
+        UInt len = load<uint32_t>(ptr);
+        ptr += 4;
+        Obj x;
+        if (kind == 'm') {
+          check_bounds(ptr, end, (len * len + 7) / 8);
+          x = NEW_PLIST(len == 0 ? T_PLIST_EMPTY : T_PLIST_TAB, len);
+          SET_LEN_PLIST(x, len);
+          for (UInt r = 1; r <= len; ++r) {
+            Obj row = NEW_BLIST(len);
+            for (UInt c = 1; c <= len; ++c) {
+              UInt b = (r - 1) * len + c - 1;
+              if (ptr[b / 8] & (1 << (b % 8))) {
+                SET_BIT_BLIST(row, c);
+              }
+            }
+            SET_ELM_PLIST(x, r, row);
+            CHANGED_BAG(x);
+          }
+          ptr += (len * len + 7) / 8;
+        } else if (width == 1 || width == 2 || width == 4) {
+          check_bounds(ptr, end, len * width);
+          x = NEW_PLIST(len == 0 ? T_PLIST_EMPTY : T_PLIST_CYC, len);
+          SET_LEN_PLIST(x, len);
+          for (UInt j = 1; j <= len; ++j, ptr += width) {
+            UInt val = (width == 1 ? *ptr
+                                   : (width == 2 ? load<uint16_t>(ptr)
+                                                 : load<uint32_t>(ptr)));
+            SET_ELM_PLIST(x, j, INTOBJ_INT(val));
+          }
+        } else {
+          throw std::runtime_error("the file is corrupt");
+        }
+        SET_ELM_PLIST(gens, k, x);
+        CHANGED_BAG(gens);
+      }
+
+      Obj result = NEW_PLIST(T_PLIST, 2);
+      SET_LEN_PLIST(result, 2);
+      SET_ELM_PLIST(result, 1, ObjsChar[static_cast<UChar>(kind)]);
+      SET_ELM_PLIST(result, 2, gens);
+      CHANGED_BAG(result);
+      return result;
+    }
+
+   private:
+    static void check_bounds(uint8_t const* ptr, uint8_t const* end, UInt n) {
+      if (static_cast<UInt>(end - ptr) < n) {
+        throw std::runtime_error("the file is corrupt");
+      }
+    }
+
+    uint8_t const* _data;
+    GensFileHeader _header;
+    size_t         _size;
+  };
+
+}  // namespace semigroups
+
+namespace gapbind14 {
+  template <>
+  struct IsGapBind14Type<semigroups::GeneratorsFile> : std::true_type {};
+}  // namespace gapbind14
+
+using semigroups::GeneratorsFile;
+
+void init_generators_file(gapbind14::Module& m) {
+  gapbind14::class_<GeneratorsFile>("GeneratorsFile")
+      .def(gapbind14::init<std::string>{}, "make")
+      .def("number_of_entries", &GeneratorsFile::number_of_entries)
+      .def("entry",
+           [](GeneratorsFile const& gf, size_t i) { return gf.entry(i); });
+
+  gapbind14::InstallGlobalFunction("is_generators_file",
+                                   &semigroups::is_generators_file);
+  gapbind14::InstallGlobalFunction("write_generators_file",
+                                   &semigroups::write_generators_file);
+}
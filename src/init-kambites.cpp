@@ -0,0 +1,60 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "init-kambites.hpp"
+
+#include <cstddef>  // for size_t
+
+// GAP headers
+#include "gap_all.h"
+
+// Semigroups pkg headers
+#include "pkg.hpp"     // for IsGapBind14Type, Pinfinity
+#include "to-cpp.hpp"  // for to_cpp
+#include "to-gap.hpp"  // for to_gap
+
+// GapBind14 headers
+#include "gapbind14/gapbind14.hpp"  // for class_ etc
+
+// libsemigroups headers
+#include "libsemigroups/constants.hpp"         // for POSITIVE_INFINITY
+#include "libsemigroups/kambites-class.hpp"    // for Kambites
+#include "libsemigroups/kambites-helpers.hpp"  // for add_generating_pair
+#include "libsemigroups/presentation.hpp"      // for Presentation
+#include "libsemigroups/types.hpp"             // for congruence_kind
+
+using libsemigroups::congruence_kind;
+using libsemigroups::Kambites;
+using libsemigroups::Presentation;
+using libsemigroups::word_type;
+
+void init_kambites(gapbind14::Module& m) {
+  gapbind14::class_<Kambites<word_type>>("Kambites")
+      .def(gapbind14::init<congruence_kind, Presentation<word_type>>{}, "make")
+      .def("add_generating_pair",
+           [](Kambites<word_type>& k, word_type const& u, word_type const& v) {
+             libsemigroups::kambites::add_generating_pair(k, u, v);
+           })
+      .def("small_overlap_class", [](Kambites<word_type>& k) -> Obj {
+        size_t result = k.small_overlap_class();
+        if (result == libsemigroups::POSITIVE_INFINITY) {
+          return Pinfinity;
+        }
+        return INTOBJ_INT(result);
+      });
+}
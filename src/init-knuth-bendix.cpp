@@ -0,0 +1,70 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "init-knuth-bendix.hpp"
+
+#include <cstddef>  // for size_t
+
+// GAP headers
+#include "gap_all.h"
+
+// Semigroups pkg headers
+#include "pkg.hpp"     // for IsGapBind14Type
+#include "to-cpp.hpp"  // for to_cpp
+#include "to-gap.hpp"  // for to_gap
+
+// GapBind14 headers
+#include "gapbind14/gapbind14.hpp"  // for class_ etc
+
+// libsemigroups headers
+#include "libsemigroups/knuth-bendix-class.hpp"    // for KnuthBendix
+#include "libsemigroups/knuth-bendix-helpers.hpp"  // for add_generating_pair
+#include "libsemigroups/presentation.hpp"          // for Presentation
+#include "libsemigroups/types.hpp"                 // for congruence_kind
+
+using libsemigroups::congruence_kind;
+using libsemigroups::KnuthBendix;
+using libsemigroups::Presentation;
+using libsemigroups::word_type;
+
+void init_knuth_bendix(gapbind14::Module& m) {
+  using options = typename KnuthBendix<word_type>::options;
+
+  gapbind14::class_<KnuthBendix<word_type>>("KnuthBendix")
+      .def(gapbind14::init<congruence_kind, Presentation<word_type>>{}, "make")
+      .def("add_generating_pair",
+           [](KnuthBendix<word_type>& kb,
+              word_type const&        u,
+              word_type const&        v) {
+             libsemigroups::knuth_bendix::add_generating_pair(kb, u, v);
+           })
+      .def("number_of_classes",
+           [](KnuthBendix<word_type>& kb) { return kb.number_of_classes(); })
+      .def("max_rules",
+           [](KnuthBendix<word_type>& kb, size_t val) { kb.max_rules(val); })
+      .def("overlap_policy",
+           [](KnuthBendix<word_type>& kb, options::overlap val) {
+             kb.overlap_policy(val);
+           })
+      .def("max_overlap",
+           [](KnuthBendix<word_type>& kb, size_t val) { kb.max_overlap(val); })
+      .def("check_confluence_interval",
+           [](KnuthBendix<word_type>& kb, size_t val) {
+             kb.check_confluence_interval(val);
+           });
+}
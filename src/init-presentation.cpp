@@ -93,6 +93,23 @@ void init_presentation(gapbind14::Module& m) {
         libsemigroups::presentation::reverse(thing);
       });
 
+  gapbind14::InstallGlobalFunction(
+      "presentation_remove_redundant_generators",
+      [](Presentation<word_type>& thing) -> void {
+        libsemigroups::presentation::remove_redundant_generators(thing);
+      });
+
+  gapbind14::InstallGlobalFunction(
+      "presentation_reduce_complements",
+      [](Presentation<word_type>& thing) -> void {
+        libsemigroups::presentation::reduce_complements(thing);
+      });
+
+  gapbind14::InstallGlobalFunction(
+      "presentation_sort_rules", [](Presentation<word_type>& thing) -> void {
+        libsemigroups::presentation::sort_rules(thing);
+      });
+
   gapbind14::InstallGlobalFunction(
       "presentation_normalize_alphabet",
       gapbind14::overload_cast<Presentation<word_type>&>(
@@ -0,0 +1,186 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains a class for racing several congruence algorithms
+// (ToddCoxeter, KnuthBendix, and Kambites) with user supplied settings against
+// each other, and reporting which one finished first.
+
+#include "init-race.hpp"
+
+#include <chrono>       // for steady_clock, nanoseconds
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint64_t
+#include <memory>       // for shared_ptr, make_shared
+#include <stdexcept>    // for runtime_error
+#include <string>       // for string
+#include <type_traits>  // for true_type
+#include <vector>       // for vector
+
+// GAP headers
+#include "gap_all.h"
+
+// Semigroups pkg headers
+#include "pkg.hpp"     // for IsGapBind14Type, Pinfinity
+#include "to-cpp.hpp"  // for to_cpp
+#include "to-gap.hpp"  // for to_gap
+
+// GapBind14 headers
+#include "gapbind14/gapbind14.hpp"  // for class_ etc
+
+// libsemigroups headers
+#include "libsemigroups/constants.hpp"           // for POSITIVE_INFINITY
+#include "libsemigroups/kambites-class.hpp"      // for Kambites
+#include "libsemigroups/knuth-bendix-class.hpp"  // for KnuthBendix
+#include "libsemigroups/runner.hpp"              // for Runner
+#include "libsemigroups/todd-coxeter-class.hpp"  // for ToddCoxeter
+#include "libsemigroups/types.hpp"               // for word_type
+
+#include "libsemigroups/detail/race.hpp"  // for Race
+
+using libsemigroups::Kambites;
+using libsemigroups::KnuthBendix;
+using libsemigroups::Runner;
+using libsemigroups::ToddCoxeter;
+using libsemigroups::word_type;
+
+namespace semigroups {
+
+  class CongruenceRace {
+   public:
+    CongruenceRace()
+        : _names(), _nanoseconds(0), _race(), _runners(), _started(false) {}
+
+    template <typename Thing>
+    void add_runner(Thing const& thing, std::string const& name) {
+      if (_started) {
+        throw std::runtime_error(
+            "cannot add a runner to a race that has already started");
+      }
+      auto ptr = std::make_shared<Thing>(thing);
+      _race.add_runner(ptr);
+      _runners.push_back(ptr);
+      _names.push_back(name);
+    }
+
+    void max_threads(size_t val) {
+      _race.max_threads(val);
+    }
+
+    void run() {
+      if (_runners.empty()) {
+        throw std::runtime_error("there are no runners in the race");
+      }
+      _started   = true;
+      auto start = std::chrono::steady_clock::now();
+      _race.run();
+      _nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    }
+
+    // Position (from 0) of the runner that won the race
+    size_t winner_index() {
+      run_if_not_started();
+      auto winner = _race.winner();
+      for (size_t i = 0; i < _runners.size(); ++i) {
+        if (_runners[i] == winner) {
+          return i;
+        }
+      }
+      throw std::runtime_error("the race has no winner");
+    }
+
+    std::string const& winner_name() {
+      return _names[winner_index()];
+    }
+
+    uint64_t nanoseconds() const noexcept {
+      return _nanoseconds;
+    }
+
+    uint64_t number_of_classes() {
+      auto winner = _runners[winner_index()];
+      if (auto tc = std::dynamic_pointer_cast<ToddCoxeter<word_type>>(winner)) {
+        return tc->number_of_classes();
+      } else if (auto kb
+                 = std::dynamic_pointer_cast<KnuthBendix<word_type>>(winner)) {
+        return kb->number_of_classes();
+      }
+      auto k = std::dynamic_pointer_cast<Kambites<word_type>>(winner);
+      return k->number_of_classes();
+    }
+
+   private:
+    void run_if_not_started() {
+      if (!_started) {
+        run();
+      }
+    }
+
+    std::vector<std::string>             _names;
+    uint64_t                             _nanoseconds;
+    libsemigroups::detail::Race          _race;
+    std::vector<std::shared_ptr<Runner>> _runners;
+    bool                                 _started;
+  };
+
+}  // namespace semigroups
+
+namespace gapbind14 {
+  template <>
+  struct IsGapBind14Type<semigroups::CongruenceRace> : std::true_type {};
+}  // namespace gapbind14
+
+using semigroups::CongruenceRace;
+
+void init_race(gapbind14::Module& m) {
+  gapbind14::class_<CongruenceRace>("CongruenceRace")
+      .def(gapbind14::init<>{}, "make")
+      .def("add_todd_coxeter",
+           [](CongruenceRace&               race,
+              ToddCoxeter<word_type> const& tc,
+              std::string const&            name) {
+             race.add_runner(tc, name);
+           })
+      .def("add_knuth_bendix",
+           [](CongruenceRace&               race,
+              KnuthBendix<word_type> const& kb,
+              std::string const&            name) {
+             race.add_runner(kb, name);
+           })
+      .def("add_kambites",
+           [](CongruenceRace&            race,
+              Kambites<word_type> const& k,
+              std::string const&         name) { race.add_runner(k, name); })
+      .def("max_threads",
+           [](CongruenceRace& race, size_t val) { race.max_threads(val); })
+      .def("run", [](CongruenceRace& race) { race.run(); })
+      .def("winner_index",
+           [](CongruenceRace& race) { return race.winner_index() + 1; })
+      .def("winner_name",
+           [](CongruenceRace& race) { return race.winner_name(); })
+      .def("nanoseconds",
+           [](CongruenceRace& race) { return race.nanoseconds(); })
+      .def("number_of_classes", [](CongruenceRace& race) -> Obj {
+        uint64_t result = race.number_of_classes();
+        if (result == libsemigroups::POSITIVE_INFINITY) {
+          return Pinfinity;
+        }
+        return INTOBJ_INT(result);
+      });
+}
@@ -18,32 +18,299 @@
 
 #include "init-sims.hpp"
 
+#include <algorithm>           // for max
+#include <atomic>              // for atomic
+#include <chrono>              // for milliseconds
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint32_t, uint64_t
+#include <deque>               // for deque
+#include <exception>           // for exception
+#include <memory>              // for shared_ptr, make_shared
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <stdexcept>           // for runtime_error
+#include <string>              // for string
+#include <thread>              // for thread
+#include <type_traits>         // for true_type
+#include <utility>             // for move
+#include <vector>              // for vector
+
 // Semigroups GAP package headers
 #include "pkg.hpp"     // for IsGapBind14Type
 #include "to-cpp.hpp"  // for to_cpp
 #include "to-gap.hpp"  // for to_gap
 
 // GAP headers
-#include "gap_all.h"  // for UInt2, UInt4
+#include "gap_all.h"  // for HaveInterrupt, TakeInterrupt
 
 // GapBind14 headers
 #include "gapbind14/gapbind14.hpp"  // for class_ etc
 
 // libsemigroups headers
-#include "libsemigroups/sims.hpp"  // for Sims1, RepOrc
+#include "libsemigroups/constants.hpp"  // for UNDEFINED
+#include "libsemigroups/sims.hpp"       // for Sims1, Sims2, RepOrc, ...
 
-using Sims1  = libsemigroups::Sims1;
-using RepOrc = libsemigroups::RepOrc;
+using Sims1         = libsemigroups::Sims1;
+using Sims2         = libsemigroups::Sims2;
+using RepOrc        = libsemigroups::RepOrc;
+using MinimalRepOrc = libsemigroups::MinimalRepOrc;
 
 template <typename Word>
 using Presentation = libsemigroups::Presentation<Word>;
 
 using word_type = libsemigroups::word_type;
 
+namespace {
+  // The word graphs produced by Sims1 have a fixed number of nodes, of which
+  // only an initial segment is active, and every active node has all of its
+  // targets defined.
+  template <typename WordGraph>
+  size_t number_of_active_nodes(WordGraph const& wg) {
+    size_t n = 0;
+    if (wg.out_degree() != 0) {
+      while (n < wg.number_of_nodes()
+             && wg.target_no_checks(n, 0) != libsemigroups::UNDEFINED) {
+        ++n;
+      }
+    }
+    return n;
+  }
+
+  // Returns the active nodes of wg as the number m of active nodes followed by
+  // the targets of these nodes (1-based).
+  template <typename WordGraph>
+  std::vector<uint32_t> pack(WordGraph const& wg) {
+    size_t const          d = wg.out_degree();
+    size_t const          m = number_of_active_nodes(wg);
+    std::vector<uint32_t> result;
+    result.reserve(m * d + 1);
+    result.push_back(m);
+    for (size_t s = 0; s < m; ++s) {
+      for (size_t a = 0; a < d; ++a) {
+        result.push_back(wg.target_no_checks(s, a) + 1);
+      }
+    }
+    return result;
+  }
+
+  // Returns a GAP list containing up to k word graphs, starting with the one
+  // pointed to by it (a Sims1 or Sims2 iterator). The list is empty if there
+  // are no more word graphs, and otherwise the first entry is the out-degree d
+  // of the word graphs followed by, for each word graph, the number m of
+  // active nodes and then the m * d targets of these nodes (1-based).
+  template <typename Iterator>
+  Obj next_batch(Iterator& it, size_t k) {
+    Obj result = NEW_PLIST(T_PLIST_CYC, 0);
+    for (size_t i = 0; i < k; ++i, ++it) {
+      auto const& wg = *it;
+      if (wg.number_of_nodes() == 0) {
+        break;
+      }
+      if (i == 0) {
+        PushPlist(result, INTOBJ_INT(wg.out_degree()));
+      }
+      for (uint32_t val : pack(wg)) {
+        PushPlist(result, INTOBJ_INT(val));
+      }
+    }
+    if (LEN_PLIST(result) == 0) {
+      RetypeBag(result, T_PLIST_EMPTY);
+    }
+    return result;
+  }
+
+  // Returns the number of word graphs with at most n classes, and with
+  // between min and max active nodes.
+  uint64_t number_of_congruences_with_nodes(Sims1&       sims1,
+                                            size_t       n,
+                                            size_t const min,
+                                            size_t const max) {
+    std::atomic<uint64_t> result(0);
+    sims1.for_each(n, [&result, min, max](auto const& wg) {
+      size_t const m = number_of_active_nodes(wg);
+      if (min <= m && m <= max) {
+        ++result;
+      }
+    });
+    return result;
+  }
+}  // namespace
+
+namespace semigroups {
+
+  // This class runs Sims1::find_if in a separate thread, which may itself use
+  // several threads, the word graphs found are stored in a bounded queue, and
+  // are retrieved from the queue in batches by the GAP iterator, in the same
+  // format as Sims1Iterator.next_batch. The order of the word graphs is not
+  // deterministic if Sims1 uses more than one thread.
+  //
+  // The state shared with the search thread is reference counted, and the
+  // search thread is detached, so that destroying a stream (for example, when
+  // the GAP iterator is garbage collected) only requests that the search stop
+  // and never waits for it. The search checks the stop flag in a pruner, and
+  // so aborts promptly even if no further word graphs are found.
+  class Sims1Stream {
+   public:
+    Sims1Stream() : _started(false), _state(std::make_shared<State>()) {}
+
+    Sims1Stream(Sims1Stream const&)            = delete;
+    Sims1Stream& operator=(Sims1Stream const&) = delete;
+
+    ~Sims1Stream() {
+      stop();
+    }
+
+    void start(Sims1 const& sims1, size_t n, size_t capacity) {
+      if (_started) {
+        throw std::runtime_error("the stream has already been started");
+      }
+      _state->capacity = std::max(capacity, static_cast<size_t>(1));
+      std::thread([state = _state, sims1 = Sims1(sims1), n]() mutable {
+        try {
+          sims1.add_pruner([state](auto const&) {
+            return !state->stop.load(std::memory_order_relaxed);
+          });
+          sims1.find_if(n,
+                        [&state](auto const& wg) { return !push(*state, wg); });
+        } catch (std::exception const& e) {
+          std::lock_guard<std::mutex> lock(state->mtx);
+          state->error = e.what();
+        }
+        {
+          std::lock_guard<std::mutex> lock(state->mtx);
+          state->done = true;
+        }
+        state->not_empty.notify_all();
+      }).detach();
+      _started = true;
+    }
+
+    // Waits until at least one word graph is available, or there are no more
+    // word graphs, and then returns up to k word graphs. The wait is
+    // interrupted, and the search stopped, if the user interrupts GAP.
+    Obj next_batch(size_t k) {
+      if (!_started) {
+        throw std::runtime_error("the stream has not been started");
+      }
+      if (!wait()) {
+        stop();
+        // No C++ objects are alive in this frame here, so it is safe for
+        // TakeInterrupt to leave it by longjmp.
+        TakeInterrupt();
+        return NEW_PLIST(T_PLIST_EMPTY, 0);
+      }
+      std::vector<std::vector<uint32_t>> batch;
+      size_t                             d;
+      {
+        std::lock_guard<std::mutex> lock(_state->mtx);
+        while (!_state->graphs.empty() && batch.size() < k) {
+          batch.push_back(std::move(_state->graphs.front()));
+          _state->graphs.pop_front();
+        }
+        if (batch.empty() && !_state->error.empty()) {
+          throw std::runtime_error(_state->error);
+        }
+        d = _state->out_degree;
+      }
+      _state->not_full.notify_all();
+
+      if (batch.empty()) {
+        return NEW_PLIST(T_PLIST_EMPTY, 0);
+      }
+      Obj result = NEW_PLIST(T_PLIST_CYC, 0);
+      PushPlist(result, INTOBJ_INT(d));
+      for (auto const& packed : batch) {
+        for (uint32_t val : packed) {
+          PushPlist(result, INTOBJ_INT(val));
+        }
+      }
+      return result;
+    }
+
+   private:
+    struct State {
+      State()
+          : capacity(0),
+            done(false),
+            error(),
+            graphs(),
+            mtx(),
+            not_empty(),
+            not_full(),
+            out_degree(0),
+            stop(false) {}
+
+      size_t                            capacity;
+      bool                              done;
+      std::string                       error;
+      std::deque<std::vector<uint32_t>> graphs;
+      std::mutex                        mtx;
+      std::condition_variable           not_empty;
+      std::condition_variable           not_full;
+      size_t                            out_degree;
+      std::atomic<bool>                 stop;
+    };
+
+    // Returns false if the stream has been stopped.
+    template <typename WordGraph>
+    static bool push(State& state, WordGraph const& wg) {
+      auto                         packed = pack(wg);
+      std::unique_lock<std::mutex> lock(state.mtx);
+      state.not_full.wait(lock, [&state]() {
+        return state.stop || state.graphs.size() < state.capacity;
+      });
+      if (state.stop) {
+        return false;
+      }
+      state.out_degree = wg.out_degree();
+      state.graphs.push_back(std::move(packed));
+      lock.unlock();
+      state.not_empty.notify_one();
+      return true;
+    }
+
+    // Waits until there is a word graph in the queue or the search is over,
+    // polling for GAP interrupts, and returns false if there was an
+    // interrupt.
+    bool wait() {
+      std::unique_lock<std::mutex> lock(_state->mtx);
+      while (!_state->not_empty.wait_for(
+          lock, std::chrono::milliseconds(100), [this]() {
+            return _state->done || !_state->graphs.empty();
+          })) {
+        if (HaveInterrupt()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(_state->mtx);
+        _state->stop = true;
+      }
+      _state->not_full.notify_all();
+    }
+
+    bool                   _started;
+    std::shared_ptr<State> _state;
+  };
+
+}  // namespace semigroups
+
+namespace gapbind14 {
+  template <>
+  struct IsGapBind14Type<semigroups::Sims1Stream> : std::true_type {};
+}  // namespace gapbind14
+
+using semigroups::Sims1Stream;
+
 void init_sims(gapbind14::Module& m) {
   gapbind14::class_<typename Sims1::iterator>("Sims1Iterator")
       .def("increment", [](typename Sims1::iterator& it) { ++it; })
-      .def("deref", [](typename Sims1::iterator const& it) { return *it; });
+      .def("deref", [](typename Sims1::iterator const& it) { return *it; })
+      .def("next_batch", &next_batch<typename Sims1::iterator>);
 
   gapbind14::class_<Sims1>("Sims1")
       .def(gapbind14::init<Presentation<word_type>>{}, "make")
@@ -54,12 +321,42 @@ void init_sims(gapbind14::Module& m) {
       .def("cbegin_long_rules",
            [](Sims1& s, size_t pos) { s.cbegin_long_rules(pos); });
 
+  gapbind14::class_<Sims1Stream>("Sims1Stream")
+      .def(gapbind14::init<>{}, "make")
+      .def("start",
+           [](Sims1Stream& s, Sims1 const& sims1, size_t n, size_t capacity) {
+             s.start(sims1, n, capacity);
+           })
+      .def("next_batch",
+           [](Sims1Stream& s, size_t k) { return s.next_batch(k); });
+
+  gapbind14::InstallGlobalFunction("sims1_number_of_congruences_with_nodes",
+                                   &number_of_congruences_with_nodes);
+
   gapbind14::InstallGlobalFunction(
       "sims1_add_included_pair",
       [](Sims1& sims1, word_type const& u, word_type const& v) {
         libsemigroups::sims::add_included_pair(sims1, u, v);
       });
 
+  gapbind14::class_<typename Sims2::iterator>("Sims2Iterator")
+      .def("next_batch", &next_batch<typename Sims2::iterator>);
+
+  gapbind14::class_<Sims2>("Sims2")
+      .def(gapbind14::init<Presentation<word_type>>{}, "make")
+      .def("number_of_threads",
+           [](Sims2& s, size_t val) { s.number_of_threads(val); })
+      .def("number_of_congruences", &Sims2::number_of_congruences)
+      .def("cbegin", &Sims2::cbegin)
+      .def("cbegin_long_rules",
+           [](Sims2& s, size_t pos) { s.cbegin_long_rules(pos); });
+
+  gapbind14::InstallGlobalFunction(
+      "sims2_add_included_pair",
+      [](Sims2& sims2, word_type const& u, word_type const& v) {
+        libsemigroups::sims::add_included_pair(sims2, u, v);
+      });
+
   gapbind14::class_<RepOrc>("RepOrc")
       .def(gapbind14::init<>{}, "make")
       .def("number_of_threads",
@@ -72,4 +369,16 @@ void init_sims(gapbind14::Module& m) {
       .def("min_nodes", [](RepOrc& ro, size_t val) { ro.min_nodes(val); })
       .def("target_size", [](RepOrc& ro, size_t val) { ro.target_size(val); })
       .def("word_graph", &RepOrc::word_graph);
+
+  gapbind14::class_<MinimalRepOrc>("MinimalRepOrc")
+      .def(gapbind14::init<>{}, "make")
+      .def("number_of_threads",
+           [](MinimalRepOrc& mro, size_t val) { mro.number_of_threads(val); })
+      .def("presentation",
+           [](MinimalRepOrc& mro, Presentation<word_type> const& p) {
+             mro.presentation(p);
+           })
+      .def("target_size",
+           [](MinimalRepOrc& mro, size_t val) { mro.target_size(val); })
+      .def("word_graph", &MinimalRepOrc::word_graph);
 }
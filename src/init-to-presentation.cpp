@@ -0,0 +1,52 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "init-to-presentation.hpp"
+
+#include <memory>  // for shared_ptr
+
+// Semigroups GAP package headers
+#include "pkg.hpp"     // for IsGapBind14Type
+#include "to-cpp.hpp"  // for to_cpp
+#include "to-gap.hpp"  // for to_gap
+
+// GapBind14 headers
+#include "gapbind14/gapbind14.hpp"  // for InstallGlobalFunction
+
+// libsemigroups headers
+#include "libsemigroups/froidure-pin-base.hpp"  // for FroidurePinBase
+#include "libsemigroups/presentation.hpp"       // for Presentation
+#include "libsemigroups/to-presentation.hpp"    // for to
+#include "libsemigroups/types.hpp"              // for word_type
+
+using libsemigroups::FroidurePinBase;
+using libsemigroups::Presentation;
+using libsemigroups::word_type;
+
+void init_to_presentation(gapbind14::Module& m) {
+  gapbind14::InstallGlobalFunction(
+      "froidure_pin_to_presentation", [](FroidurePinBase& fpb) {
+        return libsemigroups::to<Presentation<word_type>>(fpb);
+      });
+
+  gapbind14::InstallGlobalFunction(
+      "shared_ptr_froidure_pin_to_presentation",
+      [](std::shared_ptr<FroidurePinBase>& fpb) {
+        return libsemigroups::to<Presentation<word_type>>(*fpb);
+      });
+}
@@ -38,11 +38,12 @@
 #include "libsemigroups/detail/fmt.hpp"    // for format
 #include "libsemigroups/detail/print.hpp"  // for to_printable
 
-#include "libsemigroups/presentation.hpp"        // for Presentation
-#include "libsemigroups/todd-coxeter-class.hpp"  // for ToddCoxeter
-#include "libsemigroups/types.hpp"               // for congruence_kin...
-#include "libsemigroups/word-graph.hpp"          // for WordGraph
-#include "libsemigroups/word-range.hpp"          // for human_readable...
+#include "libsemigroups/presentation.hpp"          // for Presentation
+#include "libsemigroups/todd-coxeter-class.hpp"    // for ToddCoxeter
+#include "libsemigroups/todd-coxeter-helpers.hpp"  // for add_generating_pair
+#include "libsemigroups/types.hpp"                 // for congruence_kin...
+#include "libsemigroups/word-graph.hpp"            // for WordGraph
+#include "libsemigroups/word-range.hpp"            // for human_readable...
 
 using libsemigroups::congruence_kind;
 using libsemigroups::Presentation;
@@ -51,9 +52,51 @@ using libsemigroups::word_type;
 using libsemigroups::WordGraph;
 
 void init_todd_coxeter(gapbind14::Module& m) {
+  using options = typename ToddCoxeter<word_type>::options;
+
   gapbind14::class_<ToddCoxeter<word_type>>("ToddCoxeter")
       .def(gapbind14::init<congruence_kind, Presentation<word_type>>{},
            "make_from_presentation")
       .def(gapbind14::init<congruence_kind, WordGraph<uint32_t>>{},
-           "make_from_wordgraph");
+           "make_from_wordgraph")
+      .def("add_generating_pair",
+           [](ToddCoxeter<word_type>& tc,
+              word_type const&        u,
+              word_type const&        v) {
+             libsemigroups::todd_coxeter::add_generating_pair(tc, u, v);
+           })
+      .def("number_of_classes",
+           [](ToddCoxeter<word_type>& tc) { return tc.number_of_classes(); })
+      .def("strategy",
+           [](ToddCoxeter<word_type>& tc, options::strategy val) {
+             tc.strategy(val);
+           })
+      .def("lookahead_extent",
+           [](ToddCoxeter<word_type>& tc, options::lookahead_extent val) {
+             tc.lookahead_extent(val);
+           })
+      .def("lookahead_style",
+           [](ToddCoxeter<word_type>& tc, options::lookahead_style val) {
+             tc.lookahead_style(val);
+           })
+      .def("lookahead_next",
+           [](ToddCoxeter<word_type>& tc, size_t val) {
+             tc.lookahead_next(val);
+           })
+      .def("lookahead_min",
+           [](ToddCoxeter<word_type>& tc, size_t val) {
+             tc.lookahead_min(val);
+           })
+      .def("def_max",
+           [](ToddCoxeter<word_type>& tc, size_t val) { tc.def_max(val); })
+      .def("def_policy",
+           [](ToddCoxeter<word_type>& tc, options::def_policy val) {
+             tc.def_policy(val);
+           })
+      .def("large_collapse",
+           [](ToddCoxeter<word_type>& tc, size_t val) {
+             tc.large_collapse(val);
+           })
+      .def("save",
+           [](ToddCoxeter<word_type>& tc, bool val) { tc.save(val); });
 }
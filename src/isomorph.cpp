@@ -17,10 +17,952 @@
 //
 
 #include "isomorph.hpp"
+
+#include <algorithm>           // for lexicographical_compare, equal, min, sort
+#include <array>               // for array
+#include <atomic>              // for atomic
+#include <bitset>              // for bitset
+#include <chrono>              // for milliseconds
+#include <condition_variable>  // for condition_variable
+#include <cstdint>             // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <exception>           // for exception_ptr, current_exception, ...
+#include <functional>          // for ref, cref
+#include <map>                 // for map
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <thread>              // for thread
+#include <utility>             // for move, pair
+#include <vector>              // for vector
+
 #include "gap_all.h"
+#include "pkg.hpp"               // for CompactMultiplicationTableType, ...
 #include "semigroups-debug.hpp"  // for SEMIGROUPS_ASSERT
 
+// A compact multiplication table is a data object whose bag contains its type,
+// the number <n> of rows as a GAP small integer, and then the <n> ^ 2 entries
+// of the table minus 1, row by row, as uint8_t if <n> is at most 256 and as
+// uint16_t otherwise.
+
+namespace {
+
+  constexpr UInt MAX_COMPACT_MULT_TABLE_SIZE = 65536;
+
+  inline bool is_compact_mult_table(Obj o) {
+    return TNUM_OBJ(o) == T_DATOBJ
+           && CALL_1ARGS(IsCompactMultiplicationTable, o) == True;
+  }
+
+  inline UInt compact_mult_table_size(Obj ct) {
+    return INT_INTOBJ(CONST_ADDR_OBJ(ct)[1]);
+  }
+
+  inline bool is_narrow(UInt n) {
+    return n <= 256;
+  }
+
+  template <typename T>
+  inline T* compact_mult_table_entries(Obj ct) {
+    return reinterpret_cast<T*>(ADDR_OBJ(ct) + 2);
+  }
+
+  template <typename T>
+  inline T const* const_compact_mult_table_entries(Obj ct) {
+    return reinterpret_cast<T const*>(CONST_ADDR_OBJ(ct) + 2);
+  }
+
+  Obj new_compact_mult_table(UInt n) {
+    SEMIGROUPS_ASSERT(n <= MAX_COMPACT_MULT_TABLE_SIZE);
+    UInt width = (is_narrow(n) ? sizeof(uint8_t) : sizeof(uint16_t));
+    Obj  ct    = NewBag(T_DATOBJ, 2 * sizeof(Obj) + n * n * width);
+    SetTypeDatObj(ct, CompactMultiplicationTableType);
+    ADDR_OBJ(ct)[1] = INTOBJ_INT(n);
+    return ct;
+  }
+
+  inline UInt perm_image(Obj p, UInt i) {
+    if (TNUM_OBJ(p) == T_PERM2) {
+      return IMAGE(i, CONST_ADDR_PERM2(p), DEG_PERM2(p));
+    }
+    return IMAGE(i, CONST_ADDR_PERM4(p), DEG_PERM4(p));
+  }
+
+  // Returns true if <p> maps [0 .. n - 1] to itself.
+  bool perm_preserves(Obj p, UInt n) {
+    for (UInt i = 0; i < n; ++i) {
+      if (perm_image(p, i) >= n) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The entry in position (i, j) of <output> is p(table[q(i)][q(j)]) where q
+  // is the inverse of p. The images of [0 .. n - 1] under p and q are written
+  // into buffers that are reused between calls, so that the inner loop is a
+  // branch-free gather that the compiler can vectorise.
+  template <typename T>
+  void permute_compact_mult_table(Obj output, Obj table, Obj p) {
+    static std::vector<T> pimg;
+    static std::vector<T> qimg;
+
+    UInt n = compact_mult_table_size(table);
+    pimg.resize(n);
+    qimg.resize(n);
+    for (UInt i = 0; i < n; ++i) {
+      pimg[i] = perm_image(p, i);
+    }
+    for (UInt i = 0; i < n; ++i) {
+      SEMIGROUPS_ASSERT(pimg[i] < n);
+      qimg[pimg[i]] = i;
+    }
+
+    T const* src = const_compact_mult_table_entries<T>(table);
+    T*       dst = compact_mult_table_entries<T>(output);
+    for (UInt i = 0; i < n; ++i) {
+      T const* row = src + qimg[i] * n;
+      T*       out = dst + i * n;
+      for (UInt j = 0; j < n; ++j) {
+        out[j] = pimg[row[qimg[j]]];
+      }
+    }
+  }
+
+  void permute_compact_mult_table(Obj output, Obj table, Obj p) {
+    SEMIGROUPS_ASSERT(is_compact_mult_table(output));
+    SEMIGROUPS_ASSERT(is_compact_mult_table(table));
+    SEMIGROUPS_ASSERT(compact_mult_table_size(output)
+                      == compact_mult_table_size(table));
+    SEMIGROUPS_ASSERT(output != table);
+    SEMIGROUPS_ASSERT(IS_PERM(p));
+    if (is_narrow(compact_mult_table_size(table))) {
+      permute_compact_mult_table<uint8_t>(output, table, p);
+    } else {
+      permute_compact_mult_table<uint16_t>(output, table, p);
+    }
+  }
+
+  template <typename T>
+  bool compact_mult_table_eq(Obj x, Obj y, UInt n) {
+    T const* xx = const_compact_mult_table_entries<T>(x);
+    T const* yy = const_compact_mult_table_entries<T>(y);
+    return std::equal(xx, xx + n * n, yy);
+  }
+
+  template <typename T>
+  bool compact_mult_table_lt(Obj x, Obj y, UInt n) {
+    T const* xx = const_compact_mult_table_entries<T>(x);
+    T const* yy = const_compact_mult_table_entries<T>(y);
+    return std::lexicographical_compare(xx, xx + n * n, yy, yy + n * n);
+  }
+
+  void check_compact_mult_table(Obj ct, char const* arg) {
+    if (!is_compact_mult_table(ct)) {
+      ErrorQuit("the argument <%s> must be a compact multiplication table, "
+                "but found %s",
+                (Int) arg,
+                (Int) TNAM_OBJ(ct));
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////
+  // Smallest multiplication tables
+  ////////////////////////////////////////////////////////////////////////////
+
+  // The smallest multiplication table of a semigroup is the multiplication
+  // table T ^ g, where (T ^ g)[i][j] = g(T[g ^ -1(i)][g ^ -1(j)]), that is
+  // lexicographically least among those whose diagonal is lexicographically
+  // least. It is found in two passes, both of which assign the labels 0, 1,
+  // ..., n - 1 to the elements one at a time: the first pass finds the least
+  // diagonal D, and the second finds the least table among those with
+  // diagonal D.
+  //
+  // The search stops early, and returns an empty table, if the flag <cancel>
+  // passed to the constructor is set. The flag is also set if the search
+  // in one of the threads throws, and the exception is then rethrown by run.
+
+  class SmallestMultTableFinder {
+    using value_type = uint32_t;
+    using table_type = std::vector<value_type>;
+
+    static constexpr value_type UNDEFINED = static_cast<value_type>(-1);
+
+    // The state of a search, one per thread.
+    struct State {
+      explicit State(size_t n)
+          : elt(n, UNDEFINED),
+            lab(n, UNDEFINED),
+            req(n, UNDEFINED),
+            reqlab(n, UNDEFINED),
+            nr_assigned(0),
+            best(),
+            undo() {}
+
+      table_type        elt;     // elt[i] = the element labelled i
+      table_type        lab;     // lab[x] = the label of the element x
+      table_type        req;     // req[i] = the element that must be labelled i
+      table_type        reqlab;  // reqlab[x] = the label that x must have
+      size_t            nr_assigned;
+      table_type        best;
+      std::vector<bool> undo;
+    };
+
+   public:
+    SmallestMultTableFinder(table_type&&       table,
+                            size_t             n,
+                            size_t             nr_threads,
+                            std::atomic<bool>& cancel)
+        : _cancel(&cancel),
+          _diag(n),
+          _diag_best(),
+          _n(n),
+          _nr_threads(nr_threads),
+          _sig(n),
+          _table(std::move(table)) {
+      for (size_t x = 0; x < _n; ++x) {
+        _diag[x] = entry(x, x);
+      }
+      init_signatures();
+    }
+
+    table_type run() {
+      if (_n == 0) {
+        return table_type();
+      }
+      State diag_state(_n);
+      search_diag(diag_state);
+      if (cancelled()) {
+        return table_type();
+      }
+      _diag_best = std::move(diag_state.best);
+
+      // Split the search below the first few levels between the threads
+      std::vector<table_type> prefixes;
+      size_t                  depth = 0;
+      do {
+        prefixes.clear();
+        ++depth;
+        State      state(_n);
+        table_type prefix;
+        collect_prefixes(state, depth, prefix, prefixes);
+      } while (prefixes.size() < _nr_threads && depth < _n);
+
+      size_t nr_threads
+          = std::max(size_t(1), std::min(_nr_threads, prefixes.size()));
+      std::vector<State> states(nr_threads, State(_n));
+      if (nr_threads == 1) {
+        search_prefixes(states[0], prefixes, 0, 1);
+      } else {
+        std::vector<std::exception_ptr> errors(nr_threads);
+        std::vector<std::thread>        threads;
+        for (size_t i = 0; i < nr_threads; ++i) {
+          threads.emplace_back([this, &states, &prefixes, &errors, i]() {
+            try {
+              search_prefixes(states[i], prefixes, i, errors.size());
+            } catch (...) {
+              errors[i] = std::current_exception();
+              *_cancel  = true;
+            }
+          });
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+        for (auto const& error : errors) {
+          if (error) {
+            std::rethrow_exception(error);
+          }
+        }
+      }
+      if (cancelled()) {
+        return table_type();
+      }
+
+      table_type* best = nullptr;
+      for (auto& state : states) {
+        if (!state.best.empty() && (best == nullptr || state.best < *best)) {
+          best = &state.best;
+        }
+      }
+      SEMIGROUPS_ASSERT(best != nullptr);
+      return std::move(*best);
+    }
+
+   private:
+    inline bool cancelled() const {
+      return _cancel->load(std::memory_order_relaxed);
+    }
+
+    inline value_type entry(value_type x, value_type y) const {
+      return _table[x * _n + y];
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Signatures
+    ////////////////////////////////////////////////////////////////////////
+
+    // Two elements x and y that are not on any cycle of length greater than
+    // 1 of the squaring map have the same signature if and only if the trees
+    // of their preimages under the squaring map, other than themselves, are
+    // isomorphic. In the first pass, it suffices to try one of any such
+    // elements, since interchanging their trees preserves the diagonal.
+    void init_signatures() {
+      std::vector<bool> on_cycle(_n, false);
+      for (size_t x = 0; x < _n; ++x) {
+        value_type y = _diag[x];
+        for (size_t i = 0; i < _n && y != x; ++i) {
+          y = _diag[y];
+        }
+        on_cycle[x] = (y == x && _diag[x] != x);
+      }
+
+      std::vector<table_type> children(_n);
+      for (size_t x = 0; x < _n; ++x) {
+        if (_diag[x] != x && !on_cycle[x]) {
+          children[_diag[x]].push_back(x);
+        }
+      }
+
+      std::map<table_type, value_type> sigs;
+      std::vector<bool>                known(_n, false);
+      // The elements on cycles have distinct signatures
+      value_type next = 0;
+      for (size_t x = 0; x < _n; ++x) {
+        if (on_cycle[x]) {
+          _sig[x]  = next++;
+          known[x] = true;
+        }
+      }
+      // The in-trees have depth at most n, and so the following terminates
+      // after at most n passes.
+      bool done = false;
+      while (!done) {
+        done = true;
+        for (size_t x = 0; x < _n; ++x) {
+          if (known[x]) {
+            continue;
+          }
+          table_type key;
+          bool       ready = true;
+          for (value_type y : children[x]) {
+            if (!known[y]) {
+              ready = false;
+              break;
+            }
+            key.push_back(_sig[y]);
+          }
+          if (!ready) {
+            done = false;
+            continue;
+          }
+          std::sort(key.begin(), key.end());
+          auto it = sigs.find(key);
+          if (it == sigs.end()) {
+            it = sigs.emplace(std::move(key), next++).first;
+          }
+          _sig[x]  = it->second;
+          known[x] = true;
+        }
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // The first pass: the least diagonal
+    ////////////////////////////////////////////////////////////////////////
+
+    void assign(State& state, value_type x) const {
+      state.elt[state.nr_assigned] = x;
+      state.lab[x]                 = state.nr_assigned++;
+    }
+
+    void unassign(State& state) const {
+      state.lab[state.elt[--state.nr_assigned]] = UNDEFINED;
+      state.elt[state.nr_assigned]              = UNDEFINED;
+    }
+
+    // Returns true if every diagonal with the labels in <state> is greater
+    // than the least one found so far.
+    bool prune_diag(State const& state) const {
+      if (state.best.empty()) {
+        return false;
+      }
+      size_t k = state.nr_assigned;
+      for (size_t i = 0; i < k; ++i) {
+        value_type val = state.lab[_diag[state.elt[i]]];
+        if (val == UNDEFINED) {
+          // The value will be at least k
+          return state.best[i] < k;
+        } else if (val != state.best[i]) {
+          return val > state.best[i];
+        }
+      }
+      return false;
+    }
+
+    void search_diag(State& state) const {
+      size_t k = state.nr_assigned;
+      if (k == _n) {
+        table_type diag(_n);
+        for (size_t i = 0; i < _n; ++i) {
+          diag[i] = state.lab[_diag[state.elt[i]]];
+        }
+        if (state.best.empty() || diag < state.best) {
+          state.best = std::move(diag);
+        }
+        return;
+      } else if (cancelled() || prune_diag(state)) {
+        return;
+      }
+
+      // If the square of a labelled element is not labelled, then labelling
+      // it next gives the least value k in the first such position.
+      for (size_t i = 0; i < k; ++i) {
+        value_type y = _diag[state.elt[i]];
+        if (state.lab[y] == UNDEFINED) {
+          assign(state, y);
+          search_diag(state);
+          unassign(state);
+          return;
+        }
+      }
+
+      // Otherwise the value in position k is the label of the square of the
+      // element labelled k, which is least for: elements whose squares have
+      // the least label; or idempotents; or any other element.
+      value_type min = UNDEFINED;
+      for (size_t x = 0; x < _n; ++x) {
+        if (state.lab[x] == UNDEFINED) {
+          min = std::min(min, diag_value(state, x));
+        }
+      }
+      std::vector<bool> seen(_n, false);
+      for (size_t x = 0; x < _n; ++x) {
+        if (state.lab[x] == UNDEFINED && diag_value(state, x) == min) {
+          if (min <= k) {
+            if (seen[_sig[x]]) {
+              continue;
+            }
+            seen[_sig[x]] = true;
+          }
+          assign(state, x);
+          search_diag(state);
+          unassign(state);
+        }
+      }
+    }
+
+    value_type diag_value(State const& state, value_type x) const {
+      size_t k = state.nr_assigned;
+      if (state.lab[_diag[x]] != UNDEFINED) {
+        return state.lab[_diag[x]];
+      } else if (_diag[x] == x) {
+        return k;
+      }
+      return k + 1;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // The second pass: the least table with the least diagonal
+    ////////////////////////////////////////////////////////////////////////
+
+    // Returns true if labelling x next is consistent with the least
+    // diagonal.
+    bool is_valid_next(State const& state, value_type x) const {
+      size_t     k = state.nr_assigned;
+      value_type y = _diag[x];
+      value_type d = _diag_best[k];
+      if (state.lab[x] != UNDEFINED) {
+        return false;
+      } else if (state.req[k] != UNDEFINED) {
+        if (state.req[k] != x) {
+          return false;
+        }
+      } else if (state.reqlab[x] != UNDEFINED) {
+        return false;
+      }
+
+      if (d < k) {
+        return state.lab[y] == d;
+      } else if (d == k) {
+        return y == x;
+      }
+      return y != x && state.lab[y] == UNDEFINED
+             && (state.req[d] == y
+                 || (state.req[d] == UNDEFINED
+                     && state.reqlab[y] == UNDEFINED));
+    }
+
+    void assign_table(State& state, value_type x) const {
+      size_t     k         = state.nr_assigned;
+      value_type d         = _diag_best[k];
+      bool       added_req = false;
+      if (d > k && state.req[d] == UNDEFINED) {
+        state.req[d]           = _diag[x];
+        state.reqlab[_diag[x]] = d;
+        added_req              = true;
+      }
+      state.undo.push_back(added_req);
+      assign(state, x);
+    }
+
+    void unassign_table(State& state) const {
+      unassign(state);
+      size_t k = state.nr_assigned;
+      if (state.undo.back()) {
+        value_type d               = _diag_best[k];
+        state.reqlab[state.req[d]] = UNDEFINED;
+        state.req[d]               = UNDEFINED;
+      }
+      state.undo.pop_back();
+    }
+
+    // The label that the element x will have, given that the elements a and
+    // b (which may be UNDEFINED) will be labelled i and j, or UNDEFINED if
+    // this is not yet known.
+    inline value_type label(State const& state,
+                            value_type   x,
+                            value_type   a,
+                            size_t       i,
+                            value_type   b,
+                            size_t       j) const {
+      if (state.lab[x] != UNDEFINED) {
+        return state.lab[x];
+      } else if (state.reqlab[x] != UNDEFINED) {
+        return state.reqlab[x];
+      } else if (x == a) {
+        return i;
+      } else if (x == b) {
+        return j;
+      }
+      return UNDEFINED;
+    }
+
+    // The elements that might be labelled i.
+    void candidates(State const& state, size_t i, table_type& out) const {
+      out.clear();
+      if (i < state.nr_assigned) {
+        out.push_back(state.elt[i]);
+      } else if (state.req[i] != UNDEFINED) {
+        out.push_back(state.req[i]);
+      } else {
+        for (size_t x = 0; x < _n; ++x) {
+          if (state.lab[x] == UNDEFINED && state.reqlab[x] == UNDEFINED) {
+            out.push_back(x);
+          }
+        }
+      }
+    }
+
+    // Returns true if every table with the labels in <state> is at least the
+    // least one found so far. The entries of such tables are compared with
+    // the least one in order for as long as they are known.
+    bool prune_table(State const& state) const {
+      if (state.best.empty()) {
+        return false;
+      }
+      size_t     k = state.nr_assigned;
+      table_type rows, cols;
+      for (size_t i = 0; i < _n; ++i) {
+        candidates(state, i, rows);
+        for (size_t j = 0; j < _n; ++j) {
+          candidates(state, j, cols);
+          // The least possible value of the entry, and whether it is the
+          // only possible value. Every unknown label is at least k.
+          value_type best  = state.best[i * _n + j];
+          value_type val   = UNDEFINED;
+          bool       known = true;
+          for (value_type a : rows) {
+            for (value_type b : cols) {
+              if ((i == j) != (a == b)) {
+                continue;
+              }
+              value_type next = label(state, entry(a, b), a, i, b, j);
+              if (next == UNDEFINED) {
+                known = false;
+                next  = k;
+              } else if (val != UNDEFINED && next != val) {
+                known = false;
+              }
+              val = std::min(val, next);
+              if (!known && val <= best) {
+                return false;
+              }
+            }
+          }
+          if (val != best) {
+            return val > best;
+          }
+        }
+      }
+      return true;
+    }
+
+    void search_table(State& state) const {
+      size_t k = state.nr_assigned;
+      if (k == _n) {
+        table_type table(_n * _n);
+        for (size_t i = 0; i < _n; ++i) {
+          for (size_t j = 0; j < _n; ++j) {
+            table[i * _n + j] = state.lab[entry(state.elt[i], state.elt[j])];
+          }
+        }
+        if (state.best.empty() || table < state.best) {
+          state.best = std::move(table);
+        }
+        return;
+      } else if (cancelled() || prune_table(state)) {
+        return;
+      }
+      for (size_t x = 0; x < _n; ++x) {
+        if (is_valid_next(state, x)) {
+          assign_table(state, x);
+          search_table(state);
+          unassign_table(state);
+        }
+      }
+    }
+
+    void collect_prefixes(State&                   state,
+                          size_t                   depth,
+                          table_type&              prefix,
+                          std::vector<table_type>& out) const {
+      if (state.nr_assigned == depth || state.nr_assigned == _n) {
+        out.push_back(prefix);
+        return;
+      }
+      for (size_t x = 0; x < _n; ++x) {
+        if (is_valid_next(state, x)) {
+          assign_table(state, x);
+          prefix.push_back(x);
+          collect_prefixes(state, depth, prefix, out);
+          prefix.pop_back();
+          unassign_table(state);
+        }
+      }
+    }
+
+    void search_prefixes(State&                         state,
+                         std::vector<table_type> const& prefixes,
+                         size_t                         first,
+                         size_t                         step) const {
+      for (size_t i = first; i < prefixes.size(); i += step) {
+        if (cancelled()) {
+          return;
+        }
+        for (value_type x : prefixes[i]) {
+          assign_table(state, x);
+        }
+        search_table(state);
+        for (size_t j = 0; j < prefixes[i].size(); ++j) {
+          unassign_table(state);
+        }
+      }
+    }
+
+    std::atomic<bool>* _cancel;
+    table_type         _diag;
+    table_type         _diag_best;
+    size_t             _n;
+    size_t             _nr_threads;
+    table_type         _sig;
+    table_type         _table;
+  };
+
+  std::vector<uint32_t> compact_mult_table_to_vector(Obj ct) {
+    UInt                  n = compact_mult_table_size(ct);
+    std::vector<uint32_t> out(n * n);
+    for (UInt i = 0; i < n * n; ++i) {
+      if (is_narrow(n)) {
+        out[i] = const_compact_mult_table_entries<uint8_t>(ct)[i];
+      } else {
+        out[i] = const_compact_mult_table_entries<uint16_t>(ct)[i];
+      }
+    }
+    return out;
+  }
+
+  Obj vector_to_compact_mult_table(std::vector<uint32_t> const& table, UInt n) {
+    SEMIGROUPS_ASSERT(table.size() == n * n);
+    Obj out = new_compact_mult_table(n);
+    for (UInt i = 0; i < n * n; ++i) {
+      if (is_narrow(n)) {
+        compact_mult_table_entries<uint8_t>(out)[i] = table[i];
+      } else {
+        compact_mult_table_entries<uint16_t>(out)[i] = table[i];
+      }
+    }
+    return out;
+  }
+
+  void check_nr_threads(Obj nr_threads) {
+    if (!IS_POS_INTOBJ(nr_threads)) {
+      ErrorQuit("the argument <nr_threads> must be a positive integer, but "
+                "found %s",
+                (Int) TNAM_OBJ(nr_threads),
+                0L);
+    }
+  }
+
+  unsigned int nr_threads_to_use(Obj nr_threads) {
+    return std::min(static_cast<unsigned int>(INT_INTOBJ(nr_threads)),
+                    std::thread::hardware_concurrency());
+  }
+
+  // Returns a GAP list of the smallest multiplication tables of the compact
+  // multiplication tables in the GAP list <tables>, which must already have
+  // been checked. If there is only one table, then its search uses
+  // <nr_threads> threads, and otherwise each search uses one thread, and the
+  // searches are split round-robin between the threads. This thread only
+  // waits for the searches, polling for GAP interrupts, and returns 0 if
+  // there is one. If a search throws, then the exception is rethrown here.
+  Obj smallest_mult_tables(Obj tables, size_t nr_threads) {
+    size_t const                         len = LEN_LIST(tables);
+    std::atomic<bool>                    cancel(false);
+    std::vector<SmallestMultTableFinder> finders;
+    std::vector<UInt>                    sizes;
+    finders.reserve(len);
+    for (size_t i = 1; i <= len; ++i) {
+      Obj ct = ELM_LIST(tables, i);
+      sizes.push_back(compact_mult_table_size(ct));
+      finders.emplace_back(compact_mult_table_to_vector(ct),
+                           sizes.back(),
+                           (len == 1 ? nr_threads : 1),
+                           cancel);
+    }
+
+    size_t const nr = std::max(size_t(1), std::min(nr_threads, len));
+
+    std::vector<std::vector<uint32_t>> results(len);
+    std::vector<std::exception_ptr>    errors(nr);
+    std::mutex                         mtx;
+    std::condition_variable            finished;
+    size_t                             nr_finished = 0;
+
+    auto run = [&](size_t first) {
+      try {
+        for (size_t i = first; i < len && !cancel; i += nr) {
+          results[i] = finders[i].run();
+        }
+      } catch (...) {
+        errors[first] = std::current_exception();
+        cancel        = true;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++nr_finished;
+      }
+      finished.notify_one();
+    };
+
+    std::vector<std::thread> threads;
+    try {
+      for (size_t i = 0; i < nr; ++i) {
+        threads.emplace_back(run, i);
+      }
+    } catch (...) {
+      cancel = true;
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      throw;
+    }
+
+    bool interrupted = false;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      while (!finished.wait_for(lock, std::chrono::milliseconds(100), [&]() {
+        return nr_finished == threads.size();
+      })) {
+        if (!interrupted && HaveInterrupt()) {
+          interrupted = true;
+          cancel      = true;
+        }
+      }
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (auto const& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+    if (interrupted) {
+      return 0;
+    }
+
+    Obj out = NEW_PLIST(T_PLIST, len);
+    SET_LEN_PLIST(out, len);
+    for (size_t i = 0; i < len; ++i) {
+      Obj ct = vector_to_compact_mult_table(results[i], sizes[i]);
+      SET_ELM_PLIST(out, i + 1, ct);
+      CHANGED_BAG(out);
+    }
+    return out;
+  }
+
+  // GAP errors and interrupts are raised by longjmp, and so only once every
+  // C++ object used by the searches has been destroyed. If the user returns
+  // from the break loop after an interrupt, then the searches are restarted.
+  Obj checked_smallest_mult_tables(Obj tables, size_t nr_threads) {
+    while (true) {
+      Obj result = 0;
+      Obj error  = 0;
+      try {
+        result = smallest_mult_tables(tables, nr_threads);
+      } catch (std::exception const& e) {
+        error = MakeImmString(e.what());
+      }
+      if (error != 0) {
+        ErrorQuit("%s", (Int) CONST_CSTR_STRING(error), 0L);
+      } else if (result != 0) {
+        return result;
+      }
+      TakeInterrupt();
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////
+  // Fingerprints
+  ////////////////////////////////////////////////////////////////////////////
+
+  // Isomorphism invariants of a finite semigroup which are cheap to compute
+  // from its multiplication table. The principal one-sided and two-sided
+  // ideals are stored as bitsets, so that everything is computed in
+  // O(n ^ 3 / 64) time for a semigroup with n elements.
+  struct Fingerprint {
+    using bitset_type = std::vector<uint64_t>;
+    // The sizes of S ^ 1 x S ^ 1, x S ^ 1, and S ^ 1 x, and the index and
+    // period of x, for an element x.
+    using profile_type = std::array<size_t, 5>;
+
+    Fingerprint(std::vector<uint32_t> const& table, size_t n)
+        : nr_commuting_pairs(0),
+          nr_idempotents(0),
+          nr_r_classes(0),
+          nr_l_classes(0),
+          nr_h_classes(0),
+          j_class_sizes(),
+          profiles(n) {
+      size_t                   nr_words = (n + 63) / 64;
+      std::vector<bitset_type> right(n, bitset_type(nr_words, 0));
+      std::vector<bitset_type> left(n, bitset_type(nr_words, 0));
+      std::vector<bitset_type> two(n, bitset_type(nr_words, 0));
+
+      for (size_t x = 0; x < n; ++x) {
+        add(right[x], x);
+        add(left[x], x);
+        for (size_t y = 0; y < n; ++y) {
+          add(right[x], table[x * n + y]);
+          add(left[x], table[y * n + x]);
+          if (table[x * n + y] == table[y * n + x]) {
+            nr_commuting_pairs++;
+          }
+        }
+      }
+      // S ^ 1 x S ^ 1 is the union of y S ^ 1 for y in S ^ 1 x
+      for (size_t x = 0; x < n; ++x) {
+        for (size_t y = 0; y < n; ++y) {
+          if (contains(left[x], y)) {
+            for (size_t i = 0; i < nr_words; ++i) {
+              two[x][i] |= right[y][i];
+            }
+          }
+        }
+      }
+
+      std::map<bitset_type, size_t>                         r_classes;
+      std::map<bitset_type, size_t>                         l_classes;
+      std::map<bitset_type, size_t>                         j_classes;
+      std::map<std::pair<bitset_type, bitset_type>, size_t> h_classes;
+      std::vector<size_t>                                   power(n, 0);
+      std::vector<size_t>                                   powers;
+
+      for (size_t x = 0; x < n; ++x) {
+        r_classes[right[x]]++;
+        l_classes[left[x]]++;
+        j_classes[two[x]]++;
+        h_classes[std::make_pair(right[x], left[x])]++;
+
+        // power[y] = k if y = x ^ k, for the distinct powers of x
+        size_t y = x;
+        size_t k = 1;
+        while (power[y] == 0) {
+          power[y] = k++;
+          powers.push_back(y);
+          y = table[y * n + x];
+        }
+        size_t index  = power[y];
+        size_t period = k - power[y];
+        if (index == 1 && period == 1) {
+          nr_idempotents++;
+        }
+        for (size_t z : powers) {
+          power[z] = 0;
+        }
+        powers.clear();
+
+        profiles[x] = {
+            count(two[x]), count(right[x]), count(left[x]), index, period};
+      }
+      std::sort(profiles.begin(), profiles.end());
+
+      nr_r_classes = r_classes.size();
+      nr_l_classes = l_classes.size();
+      nr_h_classes = h_classes.size();
+      for (auto const& j_class : j_classes) {
+        j_class_sizes.push_back(j_class.second);
+      }
+      std::sort(j_class_sizes.begin(), j_class_sizes.end());
+    }
+
+    size_t                    nr_commuting_pairs;
+    size_t                    nr_idempotents;
+    size_t                    nr_r_classes;
+    size_t                    nr_l_classes;
+    size_t                    nr_h_classes;
+    std::vector<size_t>       j_class_sizes;
+    std::vector<profile_type> profiles;
+
+   private:
+    static void add(bitset_type& bitset, size_t i) {
+      bitset[i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    static bool contains(bitset_type const& bitset, size_t i) {
+      return (bitset[i / 64] >> (i % 64)) & 1;
+    }
+
+    static size_t count(bitset_type const& bitset) {
+      size_t result = 0;
+      for (uint64_t word : bitset) {
+        result += std::bitset<64>(word).count();
+      }
+      return result;
+    }
+  };
+
+  template <typename T>
+  Obj size_t_list_to_plist(T const& list) {
+    Obj out = NEW_PLIST(list.empty() ? T_PLIST_EMPTY : T_PLIST_CYC,
+                        list.size());
+    SET_LEN_PLIST(out, list.size());
+    for (size_t i = 0; i < list.size(); ++i) {
+      SET_ELM_PLIST(out, i + 1, INTOBJ_INT(list[i]));
+    }
+    return out;
+  }
+
+  Obj new_int_plist(UInt len) {
+    Obj out = NEW_PLIST(len == 0 ? T_PLIST_EMPTY : T_PLIST_CYC, len);
+    SET_LEN_PLIST(out, len);
+    return out;
+  }
+}  // namespace
+
 Obj PermuteMultiplicationTableNC(Obj self, Obj output, Obj table, Obj p) {
+  if (TNUM_OBJ(table) == T_DATOBJ) {
+    permute_compact_mult_table(output, table, p);
+    return 0L;
+  }
   SEMIGROUPS_ASSERT(IS_LIST(table));
   UInt n = LEN_LIST(table);
   SEMIGROUPS_ASSERT(IS_LIST(output));
@@ -87,6 +1029,34 @@ Obj PermuteMultiplicationTableNC(Obj self, Obj output, Obj table, Obj p) {
 }
 
 Obj PermuteMultiplicationTable(Obj self, Obj output, Obj table, Obj p) {
+  if (is_compact_mult_table(output) || is_compact_mult_table(table)) {
+    check_compact_mult_table(output, "output");
+    check_compact_mult_table(table, "table");
+    if (!IS_MUTABLE_OBJ(output)) {
+      ErrorMayQuit("the argument <output> must be mutable", 0L, 0L);
+    } else if (output == table) {
+      ErrorMayQuit("the arguments <output> and <table> must be distinct "
+                   "objects",
+                   0L,
+                   0L);
+    }
+    UInt n = compact_mult_table_size(table);
+    if (compact_mult_table_size(output) != n) {
+      ErrorMayQuit("the arguments <output> and <table> must have the same "
+                   "dimensions but found sizes %d and %d, respectively",
+                   compact_mult_table_size(output),
+                   n);
+    } else if (!IS_PERM(p)) {
+      ErrorMayQuit("the argument <p> must be a permutation but found type %s",
+                   (Int) TNAM_OBJ(p),
+                   0L);
+    } else if (!perm_preserves(p, n)) {
+      ErrorMayQuit("the argument <p> must map [1 .. %d] to itself", n, 0L);
+    }
+    permute_compact_mult_table(output, table, p);
+    return 0L;
+  }
+
   if (!IS_LIST(output) || !IS_LIST(table)) {
     ErrorMayQuit("the arguments <output> and <table> must be lists but found "
                  "types '%s' and '%s' respectively",
@@ -150,3 +1120,243 @@ Obj PermuteMultiplicationTable(Obj self, Obj output, Obj table, Obj p) {
   PermuteMultiplicationTableNC(self, output, table, p);
   return 0L;
 }
+
+Obj COMPACT_MULT_TABLE(Obj self, Obj table) {
+  if (!IS_LIST(table)) {
+    ErrorQuit("the argument <table> must be a list, but found %s",
+              (Int) TNAM_OBJ(table),
+              0L);
+  }
+  UInt n = LEN_LIST(table);
+  if (n > MAX_COMPACT_MULT_TABLE_SIZE) {
+    ErrorQuit("the argument <table> must have at most %d rows, but found %d",
+              (Int) MAX_COMPACT_MULT_TABLE_SIZE,
+              (Int) n);
+  }
+  for (UInt i = 1; i <= n; ++i) {
+    Obj row = ELM_LIST(table, i);
+    if (!IS_LIST(row) || LEN_LIST(row) != n) {
+      ErrorQuit("the argument <table> must be a square table, but row %d "
+                "is not a list of length %d",
+                (Int) i,
+                (Int) n);
+    }
+    for (UInt j = 1; j <= n; ++j) {
+      Obj elem = ELM_LIST(row, j);
+      if (!IS_INTOBJ(elem) || INT_INTOBJ(elem) < 1 || INT_INTOBJ(elem) > n) {
+        ErrorQuit("all entries in the argument <table> must be positive "
+                  "integers from 1 to Size(<table>) = %d",
+                  (Int) n,
+                  0L);
+      }
+    }
+  }
+
+  Obj ct = new_compact_mult_table(n);
+  for (UInt i = 1; i <= n; ++i) {
+    Obj row = ELM_LIST(table, i);
+    for (UInt j = 1; j <= n; ++j) {
+      UInt val = INT_INTOBJ(ELM_LIST(row, j)) - 1;
+      if (is_narrow(n)) {
+        compact_mult_table_entries<uint8_t>(ct)[(i - 1) * n + j - 1] = val;
+      } else {
+        compact_mult_table_entries<uint16_t>(ct)[(i - 1) * n + j - 1] = val;
+      }
+    }
+  }
+  return ct;
+}
+
+Obj COMPACT_MULT_TABLE_BUFFER(Obj self, Obj ct) {
+  check_compact_mult_table(ct, "table");
+  return new_compact_mult_table(compact_mult_table_size(ct));
+}
+
+Obj COMPACT_MULT_TABLE_SIZE(Obj self, Obj ct) {
+  check_compact_mult_table(ct, "table");
+  return INTOBJ_INT(compact_mult_table_size(ct));
+}
+
+Obj COMPACT_MULT_TABLE_EXPAND(Obj self, Obj ct) {
+  check_compact_mult_table(ct, "table");
+  UInt n   = compact_mult_table_size(ct);
+  Obj  out = NEW_PLIST(T_PLIST_TAB, n);
+  SET_LEN_PLIST(out, n);
+  for (UInt i = 0; i < n; ++i) {
+    Obj row = NEW_PLIST(T_PLIST_CYC, n);
+    SET_LEN_PLIST(row, n);
+    for (UInt j = 0; j < n; ++j) {
+      UInt val = (is_narrow(n)
+                      ? const_compact_mult_table_entries<uint8_t>(ct)[i * n + j]
+                      : const_compact_mult_table_entries<uint16_t>(
+                          ct)[i * n + j]);
+      SET_ELM_PLIST(row, j + 1, INTOBJ_INT(val + 1));
+    }
+    SET_ELM_PLIST(out, i + 1, row);
+    CHANGED_BAG(out);
+  }
+  return out;
+}
+
+Obj COMPACT_MULT_TABLE_EQ(Obj self, Obj x, Obj y) {
+  check_compact_mult_table(x, "x");
+  check_compact_mult_table(y, "y");
+  UInt n = compact_mult_table_size(x);
+  if (compact_mult_table_size(y) != n) {
+    return False;
+  } else if (is_narrow(n)) {
+    return compact_mult_table_eq<uint8_t>(x, y, n) ? True : False;
+  }
+  return compact_mult_table_eq<uint16_t>(x, y, n) ? True : False;
+}
+
+Obj COMPACT_MULT_TABLE_LT(Obj self, Obj x, Obj y) {
+  check_compact_mult_table(x, "x");
+  check_compact_mult_table(y, "y");
+  UInt n = compact_mult_table_size(x);
+  if (compact_mult_table_size(y) != n) {
+    return compact_mult_table_size(x) < compact_mult_table_size(y) ? True
+                                                                    : False;
+  } else if (is_narrow(n)) {
+    return compact_mult_table_lt<uint8_t>(x, y, n) ? True : False;
+  }
+  return compact_mult_table_lt<uint16_t>(x, y, n) ? True : False;
+}
+
+Obj SMALLEST_MULT_TABLE(Obj self, Obj ct, Obj nr_threads) {
+  check_compact_mult_table(ct, "table");
+  check_nr_threads(nr_threads);
+  Obj tables = NEW_PLIST(T_PLIST, 1);
+  SET_LEN_PLIST(tables, 1);
+  SET_ELM_PLIST(tables, 1, ct);
+  CHANGED_BAG(tables);
+  return ELM_PLIST(
+      checked_smallest_mult_tables(tables, nr_threads_to_use(nr_threads)), 1);
+}
+
+Obj SMALLEST_MULT_TABLES(Obj self, Obj tables, Obj nr_threads) {
+  if (!IS_LIST(tables)) {
+    ErrorQuit("the argument <tables> must be a list, but found %s",
+              (Int) TNAM_OBJ(tables),
+              0L);
+  }
+  check_nr_threads(nr_threads);
+  for (UInt i = 1; i <= LEN_LIST(tables); ++i) {
+    check_compact_mult_table(ELM_LIST(tables, i), "table");
+  }
+  return checked_smallest_mult_tables(tables, nr_threads_to_use(nr_threads));
+}
+
+Obj SEMIGROUP_INVARIANT_FINGERPRINT(Obj self, Obj ct) {
+  check_compact_mult_table(ct, "table");
+  UInt        n = compact_mult_table_size(ct);
+  Fingerprint fp(compact_mult_table_to_vector(ct), n);
+
+  Obj profiles = NEW_PLIST(n == 0 ? T_PLIST_EMPTY : T_PLIST, n);
+  SET_LEN_PLIST(profiles, n);
+  for (UInt i = 0; i < n; ++i) {
+    Obj profile = size_t_list_to_plist(fp.profiles[i]);
+    SET_ELM_PLIST(profiles, i + 1, profile);
+    CHANGED_BAG(profiles);
+  }
+
+  Obj out = NEW_PLIST(T_PLIST, 8);
+  SET_LEN_PLIST(out, 8);
+  SET_ELM_PLIST(out, 1, INTOBJ_INT(n));
+  SET_ELM_PLIST(out, 2, INTOBJ_INT(fp.nr_idempotents));
+  SET_ELM_PLIST(out, 3, INTOBJ_INT(fp.nr_commuting_pairs));
+  SET_ELM_PLIST(out, 4, INTOBJ_INT(fp.nr_r_classes));
+  SET_ELM_PLIST(out, 5, INTOBJ_INT(fp.nr_l_classes));
+  SET_ELM_PLIST(out, 6, INTOBJ_INT(fp.nr_h_classes));
+  SET_ELM_PLIST(out, 7, profiles);
+  CHANGED_BAG(out);
+  Obj j_class_sizes = size_t_list_to_plist(fp.j_class_sizes);
+  SET_ELM_PLIST(out, 8, j_class_sizes);
+  CHANGED_BAG(out);
+  return out;
+}
+
+// Returns a list [out, colours] where out is the list of out-neighbours of a
+// vertex coloured digraph whose automorphisms restricted to [1 .. n] are the
+// automorphisms of the semigroup with compact multiplication table <ct> of
+// size n. The vertices are: the elements 1, ..., n (colour 1); the pairs (x,
+// y) for x, y in [1 .. n] numbered x * n + y (colour 2); and n + n ^ 2 + x
+// for every x in [1 .. n] (colour 3).
+//
+// If <small> is false, then there are edges x -> (x, y) and (x, y) -> xy,
+// (x, y) -> (z, y) for every z <> x, and (x, x) -> n + n ^ 2 + x, in this
+// order, as in the original GAP implementation of SEMIGROUPS.CanonicalDigraph,
+// whose canonical labellings are used by CanonicalMultiplicationTablePerm.
+//
+// If <small> is true, then the n ^ 3 edges between pairs are replaced by
+// the edges y -> n + n ^ 2 + y and (x, y) -> n + n ^ 2 + y, so that the
+// digraph has O(n ^ 2) edges.
+Obj MULT_TABLE_DIGRAPH(Obj self, Obj ct, Obj small) {
+  check_compact_mult_table(ct, "table");
+  if (small != True && small != False) {
+    ErrorQuit("the argument <small> must be true or false, but found %s",
+              (Int) TNAM_OBJ(small),
+              0L);
+  }
+  UInt                  n     = compact_mult_table_size(ct);
+  std::vector<uint32_t> table = compact_mult_table_to_vector(ct);
+  UInt                  nr    = n * n + 2 * n;
+
+  Obj out = NEW_PLIST(T_PLIST, nr);
+  SET_LEN_PLIST(out, nr);
+  Obj colours = new_int_plist(nr);
+  for (UInt v = 1; v <= nr; ++v) {
+    UInt colour = (v <= n ? 1 : (v <= n * n + n ? 2 : 3));
+    SET_ELM_PLIST(colours, v, INTOBJ_INT(colour));
+  }
+
+  for (UInt x = 1; x <= n; ++x) {
+    Obj row = new_int_plist(small == True ? n + 1 : n);
+    for (UInt y = 1; y <= n; ++y) {
+      SET_ELM_PLIST(row, y, INTOBJ_INT(x * n + y));
+    }
+    if (small == True) {
+      SET_ELM_PLIST(row, n + 1, INTOBJ_INT(n * n + n + x));
+    }
+    SET_ELM_PLIST(out, x, row);
+    CHANGED_BAG(out);
+  }
+
+  for (UInt x = 1; x <= n; ++x) {
+    for (UInt y = 1; y <= n; ++y) {
+      UInt xy = table[(x - 1) * n + y - 1] + 1;
+      Obj  row;
+      if (small == True) {
+        row = new_int_plist(2);
+        SET_ELM_PLIST(row, 1, INTOBJ_INT(xy));
+        SET_ELM_PLIST(row, 2, INTOBJ_INT(n * n + n + y));
+      } else {
+        UInt pos = 1;
+        row      = new_int_plist(x == y ? n + 1 : n);
+        if (x == y) {
+          SET_ELM_PLIST(row, pos++, INTOBJ_INT(n * n + n + x));
+        }
+        SET_ELM_PLIST(row, pos++, INTOBJ_INT(xy));
+        for (UInt z = 1; z <= n; ++z) {
+          if (z != x) {
+            SET_ELM_PLIST(row, pos++, INTOBJ_INT(z * n + y));
+          }
+        }
+      }
+      SET_ELM_PLIST(out, x * n + y, row);
+      CHANGED_BAG(out);
+    }
+  }
+
+  for (UInt v = n * n + n + 1; v <= nr; ++v) {
+    SET_ELM_PLIST(out, v, new_int_plist(0));
+    CHANGED_BAG(out);
+  }
+
+  Obj result = NEW_PLIST(T_PLIST, 2);
+  SET_LEN_PLIST(result, 2);
+  SET_ELM_PLIST(result, 1, out);
+  SET_ELM_PLIST(result, 2, colours);
+  CHANGED_BAG(result);
+  return result;
+}
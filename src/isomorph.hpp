@@ -29,6 +29,17 @@ extern "C" {
 Obj PermuteMultiplicationTableNC(Obj self, Obj temp, Obj M, Obj p);
 Obj PermuteMultiplicationTable(Obj self, Obj temp, Obj M, Obj p);
 
+Obj COMPACT_MULT_TABLE(Obj self, Obj table);
+Obj COMPACT_MULT_TABLE_BUFFER(Obj self, Obj ct);
+Obj COMPACT_MULT_TABLE_SIZE(Obj self, Obj ct);
+Obj COMPACT_MULT_TABLE_EXPAND(Obj self, Obj ct);
+Obj COMPACT_MULT_TABLE_EQ(Obj self, Obj x, Obj y);
+Obj COMPACT_MULT_TABLE_LT(Obj self, Obj x, Obj y);
+Obj SMALLEST_MULT_TABLE(Obj self, Obj ct, Obj nr_threads);
+Obj SMALLEST_MULT_TABLES(Obj self, Obj tables, Obj nr_threads);
+Obj SEMIGROUP_INVARIANT_FINGERPRINT(Obj self, Obj ct);
+Obj MULT_TABLE_DIGRAPH(Obj self, Obj ct, Obj small);
+
 #ifdef __cplusplus
 }
 #endif
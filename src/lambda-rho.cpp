@@ -0,0 +1,113 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "lambda-rho.hpp"
+
+#include <algorithm>  // for fill, max
+#include <cstddef>    // for size_t
+#include <vector>     // for vector
+
+// GAP headers
+#include "gap_all.h"  // for Obj, ADDR_TRANS2, DEG_TRANS, ...
+
+namespace {
+  // Used to record which points have been seen, reused between calls.
+  std::vector<UInt4> _seen;
+
+  void check_args(Obj buf, Obj f, Obj n) {
+    if (!IS_PLIST(buf) || !IS_MUTABLE_OBJ(buf)) {
+      ErrorQuit("the 1st argument must be a mutable plain list, found a %s",
+                (Int) TNAM_OBJ(buf),
+                0L);
+    } else if (!IS_TRANS(f)) {
+      ErrorQuit("the 2nd argument must be a transformation, found a %s",
+                (Int) TNAM_OBJ(f),
+                0L);
+    } else if (!IS_INTOBJ(n) || INT_INTOBJ(n) < 0) {
+      ErrorQuit("the 3rd argument must be a non-negative integer, found a %s",
+                (Int) TNAM_OBJ(n),
+                0L);
+    }
+  }
+
+  // Returns the image of the point i (0-based) under f, which is either a
+  // transformation on 2 or 4 byte points.
+  template <typename T>
+  inline UInt image(T const* ptf, UInt deg, UInt i) {
+    return (i < deg ? ptf[i] : i);
+  }
+
+  template <typename T>
+  void image_set(Obj buf, T const* ptf, UInt deg, UInt n) {
+    _seen.assign(std::max(deg, n), 0);
+    for (UInt i = 0; i < n; ++i) {
+      _seen[image(ptf, deg, i)] = 1;
+    }
+    UInt rank = 0;
+    for (UInt j = 0; j < _seen.size(); ++j) {
+      if (_seen[j] != 0) {
+        SET_ELM_PLIST(buf, ++rank, INTOBJ_INT(j + 1));
+      }
+    }
+    SET_LEN_PLIST(buf, rank);
+  }
+
+  // The classes of the kernel are numbered in the order that their least
+  // points occur, exactly as in FLAT_KERNEL_TRANS_INT.
+  template <typename T>
+  void flat_kernel(Obj buf, T const* ptf, UInt deg, UInt n) {
+    _seen.assign(std::max(deg, n), 0);
+    UInt rank = 0;
+    for (UInt i = 0; i < n; ++i) {
+      UInt const j = image(ptf, deg, i);
+      if (_seen[j] == 0) {
+        _seen[j] = ++rank;
+      }
+      SET_ELM_PLIST(buf, i + 1, INTOBJ_INT(_seen[j]));
+    }
+    SET_LEN_PLIST(buf, n);
+  }
+}  // namespace
+
+// Returns <buf> which contains IMAGE_SET_TRANS_INT(f, n) after calling this.
+Obj IMAGE_SET_TRANS_INT_SCRATCH(Obj self, Obj buf, Obj f, Obj n) {
+  check_args(buf, f, n);
+  UInt const m = INT_INTOBJ(n);
+  GROW_PLIST(buf, m);
+  if (TNUM_OBJ(f) == T_TRANS2) {
+    image_set(buf, ADDR_TRANS2(f), DEG_TRANS(f), m);
+  } else {
+    image_set(buf, ADDR_TRANS4(f), DEG_TRANS(f), m);
+  }
+  RetypeBag(buf, LEN_PLIST(buf) == 0 ? T_PLIST_EMPTY : T_PLIST_CYC_SSORT);
+  return buf;
+}
+
+// Returns <buf> which contains FLAT_KERNEL_TRANS_INT(f, n) after calling this.
+Obj FLAT_KERNEL_TRANS_INT_SCRATCH(Obj self, Obj buf, Obj f, Obj n) {
+  check_args(buf, f, n);
+  UInt const m = INT_INTOBJ(n);
+  GROW_PLIST(buf, m);
+  if (TNUM_OBJ(f) == T_TRANS2) {
+    flat_kernel(buf, ADDR_TRANS2(f), DEG_TRANS(f), m);
+  } else {
+    flat_kernel(buf, ADDR_TRANS4(f), DEG_TRANS(f), m);
+  }
+  RetypeBag(buf, LEN_PLIST(buf) == 0 ? T_PLIST_EMPTY : T_PLIST_CYC);
+  return buf;
+}
@@ -0,0 +1,33 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains declarations of kernel functions that compute lambda and
+// rho values of transformations (the image sets and flat kernels) into a
+// scratch plist <buf>, which is overwritten on every call. These are used in
+// the main loop of Enumerate for semigroup data (gap/main/acting.gi) where
+// the values are only looked up in a hash table, and are usually discarded.
+
+#ifndef SEMIGROUPS_SRC_LAMBDA_RHO_HPP_
+#define SEMIGROUPS_SRC_LAMBDA_RHO_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj IMAGE_SET_TRANS_INT_SCRATCH(Obj self, Obj buf, Obj f, Obj n);
+Obj FLAT_KERNEL_TRANS_INT_SCRATCH(Obj self, Obj buf, Obj f, Obj n);
+
+#endif  // SEMIGROUPS_SRC_LAMBDA_RHO_HPP_
@@ -0,0 +1,306 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "maxplusmat.hpp"
+
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int64_t
+#include <limits>     // for numeric_limits
+#include <vector>     // for vector
+
+// GAP headers
+#include "gap_all.h"  // for Obj, ELM_LIST, SIZE_INT, ObjInt_Int8, ...
+
+// Semigroups package for GAP headers
+#include "pkg.hpp"  // for Pinfinity, Ninfinity
+
+namespace {
+  using entry_type = int64_t;
+
+  constexpr entry_type POS_INF = std::numeric_limits<entry_type>::max();
+  constexpr entry_type NEG_INF = std::numeric_limits<entry_type>::min();
+
+  // The products are computed in std::vectors, and so errors found while
+  // computing them cannot be raised with ErrorQuit, which would longjmp past
+  // the destructors of the vectors. Instead the following exceptions are
+  // thrown, and they are handled by <checked> once the vectors have been
+  // destroyed. A bad_entry is a GAP error, and too_large means that the
+  // entries or the product do not fit into entry_type, in which case the
+  // product is computed in GAP instead.
+  struct bad_entry {
+    Obj val;
+  };
+
+  struct too_large {};
+
+  size_t dimension(Obj x) {
+    if (TNUM_OBJ(x) != T_POSOBJ) {
+      ErrorQuit("expected a matrix over a semiring, found a %s",
+                (Int) TNAM_OBJ(x),
+                0L);
+    }
+    return LEN_LIST(ELM_PLIST(x, 1));
+  }
+
+  entry_type to_entry(Obj val) {
+    if (IS_INTOBJ(val)) {
+      return INT_INTOBJ(val);
+    } else if (val == Pinfinity) {
+      return POS_INF;
+    } else if (val == Ninfinity) {
+      return NEG_INF;
+    } else if (IS_INT(val)) {
+      // A large integer, Int8_ObjInt is not used, since it raises a GAP
+      // error if val does not fit.
+      if (SIZE_INT(val) != 1
+          || CONST_ADDR_INT(val)[0] >= static_cast<UInt>(POS_INF)) {
+        throw too_large();
+      }
+      entry_type const result = CONST_ADDR_INT(val)[0];
+      return (TNUM_OBJ(val) == T_INTNEG ? -result : result);
+    }
+    throw bad_entry{val};
+  }
+
+  Obj to_gap(entry_type val) {
+    if (val == POS_INF) {
+      return Pinfinity;
+    } else if (val == NEG_INF) {
+      return Ninfinity;
+    }
+    return ObjInt_Int8(val);
+  }
+
+  // Returns the entries in the first n rows and columns of x in row-major
+  // order.
+  std::vector<entry_type> entries(Obj x, size_t n) {
+    std::vector<entry_type> result;
+    result.reserve(n * n);
+    for (size_t i = 1; i <= n; ++i) {
+      Obj row = ELM_PLIST(x, i);
+      for (size_t j = 1; j <= n; ++j) {
+        result.push_back(to_entry(ELM_LIST(row, j)));
+      }
+    }
+    return result;
+  }
+
+  // The multiplication of the max-plus and min-plus semirings
+  inline entry_type plus(entry_type a, entry_type b) {
+    if (a == POS_INF || b == POS_INF) {
+      return POS_INF;
+    } else if (a == NEG_INF || b == NEG_INF) {
+      return NEG_INF;
+    }
+    entry_type result;
+    if (__builtin_add_overflow(a, b, &result) || result == POS_INF
+        || result == NEG_INF) {
+      throw too_large();
+    }
+    return result;
+  }
+
+  inline entry_type times(entry_type a, entry_type b) {
+    entry_type result;
+    if (__builtin_mul_overflow(a, b, &result)) {
+      throw too_large();
+    }
+    return result;
+  }
+
+  // Returns the product of the matrices x and y over the semiring with
+  // addition <add>, multiplication <mult>, and zero <zero>. Every entry of the
+  // product is passed through <reduce> before it is stored.
+  template <typename TAdd, typename TMult, typename TReduce>
+  std::vector<entry_type> product(Obj        x,
+                                  Obj        y,
+                                  size_t     n,
+                                  entry_type zero,
+                                  TAdd&&     add,
+                                  TMult&&    mult,
+                                  TReduce&&  reduce) {
+    std::vector<entry_type> const xx = entries(x, n);
+    std::vector<entry_type> const yy = entries(y, n);
+    std::vector<entry_type>       result(n * n, zero);
+
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        entry_type val = zero;
+        for (size_t k = 0; k < n; ++k) {
+          val = add(val, mult(xx[i * n + k], yy[k * n + j]));
+        }
+        result[i * n + j] = reduce(val);
+      }
+    }
+    return result;
+  }
+
+  Obj rows(std::vector<entry_type> const& xy, size_t n) {
+    Obj result = NEW_PLIST(T_PLIST_TAB_RECT, n);
+    SET_LEN_PLIST(result, n);
+    for (size_t i = 0; i < n; ++i) {
+      Obj row = NEW_PLIST(T_PLIST, n);
+      SET_LEN_PLIST(row, n);
+      SET_ELM_PLIST(result, i + 1, row);
+      CHANGED_BAG(result);
+      for (size_t j = 0; j < n; ++j) {
+        SET_ELM_PLIST(row, j + 1, to_gap(xy[i * n + j]));
+        CHANGED_BAG(row);
+      }
+    }
+    return result;
+  }
+
+  entry_type max_entry(entry_type a, entry_type b) {
+    return std::max(a, b);
+  }
+
+  entry_type min_entry(entry_type a, entry_type b) {
+    return std::min(a, b);
+  }
+
+  entry_type no_reduce(entry_type a) {
+    return a;
+  }
+
+  // Returns the value of <f>(), which computes a product, or fail if the
+  // entries are too large, raising a GAP error if an entry is invalid.
+  template <typename TFunc>
+  Obj checked(TFunc&& f) {
+    Obj val = 0;
+    try {
+      return f();
+    } catch (bad_entry const& e) {
+      val = e.val;
+    } catch (too_large const&) {
+      return Fail;
+    }
+    // The exception has been destroyed here, and so it is safe to longjmp.
+    ErrorQuit("expected an entry of a matrix over a semiring, found a %s",
+              (Int) TNAM_OBJ(val),
+              0L);
+    return 0;
+  }
+
+  // A threshold or period which is a large positive integer is replaced by
+  // the largest finite entry_type, which gives the same products, since no
+  // entry can exceed it without the product being too large anyway.
+  entry_type threshold_arg(Obj threshold) {
+    if (TNUM_OBJ(threshold) == T_INTPOS) {
+      return POS_INF - 1;
+    } else if (!IS_INTOBJ(threshold) || INT_INTOBJ(threshold) < 0) {
+      ErrorQuit("the threshold must be a non-negative integer, found a %s",
+                (Int) TNAM_OBJ(threshold),
+                0L);
+    }
+    return INT_INTOBJ(threshold);
+  }
+}  // namespace
+
+Obj MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y) {
+  size_t const n = std::min(dimension(x), dimension(y));
+  return checked([&]() {
+    return rows(product(x, y, n, NEG_INF, max_entry, plus, no_reduce), n);
+  });
+}
+
+Obj MIN_PLUS_MAT_PROD(Obj self, Obj x, Obj y) {
+  size_t const n = std::min(dimension(x), dimension(y));
+  return checked([&]() {
+    return rows(product(x, y, n, POS_INF, min_entry, plus, no_reduce), n);
+  });
+}
+
+Obj TROPICAL_MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold) {
+  size_t const     n = std::min(dimension(x), dimension(y));
+  entry_type const t = threshold_arg(threshold);
+  return checked([&]() {
+    return rows(product(x,
+                        y,
+                        n,
+                        NEG_INF,
+                        max_entry,
+                        plus,
+                        [t](entry_type val) { return std::min(val, t); }),
+                n);
+  });
+}
+
+Obj TROPICAL_MIN_PLUS_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold) {
+  size_t const     n = std::min(dimension(x), dimension(y));
+  entry_type const t = threshold_arg(threshold);
+  return checked([&]() {
+    return rows(product(x,
+                        y,
+                        n,
+                        POS_INF,
+                        min_entry,
+                        plus,
+                        [t](entry_type val) {
+                          return (val != POS_INF && val > t ? t : val);
+                        }),
+                n);
+  });
+}
+
+// The product of projective max-plus matrices is normalised by subtracting
+// the largest entry from every entry that is not -infinity.
+Obj PROJ_MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y) {
+  size_t const n = std::min(dimension(x), dimension(y));
+  return checked([&]() {
+    std::vector<entry_type> xy
+        = product(x, y, n, NEG_INF, max_entry, plus, no_reduce);
+    entry_type const norm = *std::max_element(xy.cbegin(), xy.cend());
+    if (norm != NEG_INF) {
+      for (auto& val : xy) {
+        if (val != NEG_INF) {
+          val -= norm;
+        }
+      }
+    }
+    return rows(xy, n);
+  });
+}
+
+// The entries are reduced after every addition, which gives the same result
+// as reducing once at the end, since the reduction is compatible with
+// addition and multiplication, but keeps the intermediate values small.
+Obj NTP_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold, Obj period) {
+  size_t const     n = std::min(dimension(x), dimension(y));
+  entry_type const t = threshold_arg(threshold);
+  if (!IS_POS_INTOBJ(period) && TNUM_OBJ(period) != T_INTPOS) {
+    ErrorQuit("the period must be a positive integer, found a %s",
+              (Int) TNAM_OBJ(period),
+              0L);
+  }
+  entry_type const p = (IS_INTOBJ(period) ? INT_INTOBJ(period) : POS_INF - 1);
+
+  auto reduce = [t, p](entry_type val) {
+    return (val > t ? t + (val - t) % p : val);
+  };
+  auto add = [&reduce](entry_type a, entry_type b) {
+    entry_type result;
+    if (__builtin_add_overflow(a, b, &result)) {
+      throw too_large();
+    }
+    return reduce(result);
+  };
+  return checked(
+      [&]() { return rows(product(x, y, n, 0, add, times, reduce), n); });
+}
@@ -0,0 +1,42 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains declarations of kernel functions for the products of the
+// matrices over semirings in gap/elements/maxplusmat.gi, i.e. positional
+// objects whose rows are plain lists of integers, infinity, or -infinity.
+// The entries are unboxed into 64-bit integers, where infinity and -infinity
+// are represented by the largest and smallest values, respectively.
+//
+// Each of the functions returns the list of rows of the product, which is
+// turned into a matrix by MatrixNC in the GAP library, or fail if the entries
+// or the product do not fit into 64-bit integers, in which case the product
+// is computed in GAP.
+
+#ifndef SEMIGROUPS_SRC_MAXPLUSMAT_HPP_
+#define SEMIGROUPS_SRC_MAXPLUSMAT_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y);
+Obj MIN_PLUS_MAT_PROD(Obj self, Obj x, Obj y);
+Obj TROPICAL_MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold);
+Obj TROPICAL_MIN_PLUS_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold);
+Obj PROJ_MAX_PLUS_MAT_PROD(Obj self, Obj x, Obj y);
+Obj NTP_MAT_PROD(Obj self, Obj x, Obj y, Obj threshold, Obj period);
+
+#endif  // SEMIGROUPS_SRC_MAXPLUSMAT_HPP_
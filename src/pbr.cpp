@@ -0,0 +1,118 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "pbr.hpp"
+
+#include <cstddef>  // for size_t
+
+// GAP headers
+#include "gap_all.h"  // for Obj, ELM_LIST, LEN_LIST, ...
+
+// Semigroups package for GAP headers
+#include "to-cpp.hpp"  // for to_cpp
+#include "to-gap.hpp"  // for to_gap
+
+// libsemigroups headers
+#include "libsemigroups/pbr.hpp"  // for PBR
+
+using gapbind14::to_cpp;
+using gapbind14::to_gap;
+using libsemigroups::PBR;
+
+namespace {
+  inline size_t degree(Obj x) {
+    return INT_INTOBJ(ELM_PLIST(x, 1));
+  }
+
+  // Compares the lists of integers <x> and <y> in the same way as GAP does,
+  // i.e. lexicographically, and returns -1, 0, or 1 if <x> is less than,
+  // equal to, or greater than <y>, respectively.
+  int compare(Obj x, Obj y) {
+    size_t const m = LEN_LIST(x);
+    size_t const n = LEN_LIST(y);
+    for (size_t i = 1; i <= m && i <= n; ++i) {
+      Int const a = INT_INTOBJ(ELM_LIST(x, i));
+      Int const b = INT_INTOBJ(ELM_LIST(y, i));
+      if (a != b) {
+        return (a < b ? -1 : 1);
+      }
+    }
+    return (m == n ? 0 : (m < n ? -1 : 1));
+  }
+}  // namespace
+
+// The product is computed by libsemigroups, which replaces the pair of
+// mutually recursive depth first searches formerly used in the GAP library.
+Obj PBR_PROD(Obj self, Obj x, Obj y) {
+  if (degree(x) == 0) {
+    return x;
+  }
+  PBR const xx = to_cpp<PBR>()(x);
+  PBR const yy = to_cpp<PBR>()(y);
+  PBR       xy(xx.degree());
+  xy.product_inplace_no_checks(xx, yy);
+  return to_gap<PBR>()(xy);
+}
+
+Obj PBR_EQ(Obj self, Obj x, Obj y) {
+  size_t const n = degree(x);
+  if (degree(y) != n) {
+    return False;
+  }
+  for (size_t i = 2; i <= 2 * n + 1; ++i) {
+    if (compare(ELM_PLIST(x, i), ELM_PLIST(y, i)) != 0) {
+      return False;
+    }
+  }
+  return True;
+}
+
+Obj PBR_LT(Obj self, Obj x, Obj y) {
+  size_t const n = degree(x);
+  size_t const m = degree(y);
+  if (n != m) {
+    return (n < m ? True : False);
+  }
+  for (size_t i = 2; i <= 2 * n + 1; ++i) {
+    int const c = compare(ELM_PLIST(x, i), ELM_PLIST(y, i));
+    if (c != 0) {
+      return (c < 0 ? True : False);
+    }
+  }
+  return False;
+}
+
+Obj PBR_HASH(Obj self, Obj x, Obj data) {
+  if (!IS_POS_INTOBJ(data)) {
+    ErrorQuit("the 2nd argument must be a positive small integer, found a %s",
+              (Int) TNAM_OBJ(data),
+              0L);
+  }
+  UInt const   mod = INT_INTOBJ(data);
+  size_t const n   = degree(x);
+  UInt         h   = 0;
+  for (size_t i = 2; i <= 2 * n + 1; ++i) {
+    Obj          adj = ELM_PLIST(x, i);
+    size_t const m   = LEN_LIST(adj);
+    for (size_t j = 1; j <= m; ++j) {
+      h = h * 17 + INT_INTOBJ(ELM_LIST(adj, j));
+    }
+    h = h * 17 + 2 * n + 1;  // separates the adjacencies of distinct vertices
+  }
+  return INTOBJ_INT((h % mod) + 1);
+}
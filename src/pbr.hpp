@@ -0,0 +1,34 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains declarations of kernel functions for the partitioned
+// binary relations (PBRs) in gap/elements/pbr.gi, i.e. positional objects <x>
+// where <x>![1] is the degree <n> of <x> and <x>![i + 1] is the list of
+// vertices adjacent to the vertex <i> in [1 .. 2 * n].
+
+#ifndef SEMIGROUPS_SRC_PBR_HPP_
+#define SEMIGROUPS_SRC_PBR_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj PBR_PROD(Obj self, Obj x, Obj y);
+Obj PBR_EQ(Obj self, Obj x, Obj y);
+Obj PBR_LT(Obj self, Obj x, Obj y);
+Obj PBR_HASH(Obj self, Obj x, Obj data);
+
+#endif  // SEMIGROUPS_SRC_PBR_HPP_
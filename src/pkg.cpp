@@ -32,20 +32,32 @@
 #include "gap_all.h"
 
 // Semigroups package for GAP headers
-#include "bipart.hpp"  // for Blocks, Bipartition
+#include "bipart.hpp"   // for Blocks, Bipartition
+#include "boolmat.hpp"  // for BOOLEAN_MAT_PROD etc
+#include "conginv.hpp"
 #include "conglatt.hpp"
 #include "froidure-pin-fallback.hpp"  // for RUN_FROIDURE_PIN
 #include "isomorph.hpp"               // for permuting multiplication tables
+#include "lambda-rho.hpp"             // for IMAGE_SET_TRANS_INT_SCRATCH
+#include "maxplusmat.hpp"             // for MAX_PLUS_MAT_PROD etc
+#include "pbr.hpp"                    // for PBR_PROD etc
 #include "semigroups-debug.hpp"       // for SEMIGROUPS_ASSERT
+#include "stabchain.hpp"              // for STAB_CHAIN_CONTAINS
+#include "tietze.hpp"                 // for STZ_FREQUENT_SUBWORD etc
 #include "to-cpp.hpp"                 // for to_cpp
 #include "to-gap.hpp"                 // for to_gap
 
 #include "init-cong.hpp"             // for init_cong
 #include "init-froidure-pin.hpp"     // for init_froidure_pin
+#include "init-generators-file.hpp"  // for init_generators_file
+#include "init-kambites.hpp"         // for init_kambites
+#include "init-knuth-bendix.hpp"     // for init_knuth_bendix
 #include "init-presentation.hpp"     // for init_presentation
+#include "init-race.hpp"             // for init_race
 #include "init-sims.hpp"             // for init_sims
 #include "init-to-congruence.hpp"    // for init_to_congruence
 #include "init-to-froidure-pin.hpp"  // for init_to_froidure_pin
+#include "init-to-presentation.hpp"  // for init_to_presentation
 #include "init-todd-coxeter.hpp"     // for init_todd_coxeter
 
 // Gapbind14 headers
@@ -86,6 +98,8 @@ GAPBIND14_MODULE(libsemigroups) {
       gapbind14::overload_cast<word_type, word_type>(
           &libsemigroups::freeband_equal_to<word_type>));
 
+  gapbind14::InstallGlobalFunction("KERNEL_TRACE_CLOSURE",
+                                   &semigroups::KERNEL_TRACE_CLOSURE);
   gapbind14::InstallGlobalFunction("LATTICE_OF_CONGRUENCES",
                                    &semigroups::LATTICE_OF_CONGRUENCES);
 
@@ -106,11 +120,16 @@ GAPBIND14_MODULE(libsemigroups) {
   init_presentation(gapbind14::module());
 
   init_cong(gapbind14::module());
+  init_generators_file(gapbind14::module());
+  init_kambites(gapbind14::module());
+  init_knuth_bendix(gapbind14::module());
+  init_race(gapbind14::module());
   init_sims(gapbind14::module());
   init_todd_coxeter(gapbind14::module());
 
   init_to_congruence(gapbind14::module());
   init_to_froidure_pin(gapbind14::module());
+  init_to_presentation(gapbind14::module());
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -278,6 +297,8 @@ Obj DegreeOfPBR;
 Obj LARGEST_MOVED_PT_TRANS;
 Obj IsDigraph;
 Obj OutNeighbours;
+Obj IsCompactMultiplicationTable;
+Obj CompactMultiplicationTableType;
 
 Obj IsSemigroup;
 Obj IsMatrixObj;
@@ -367,8 +388,56 @@ static StructGVarFunc GVarFuncs[] = {
                BIPART_NR_IDEMPOTENTS,
                4,
                "o, scc, lookup, nr_threads"),
+    GVAR_ENTRY("boolmat.cpp", BOOLEAN_MAT_PROD, 2, "x, y"),
+    GVAR_ENTRY("boolmat.cpp", BOOLEAN_MAT_EQ, 2, "x, y"),
+    GVAR_ENTRY("boolmat.cpp", BOOLEAN_MAT_LT, 2, "x, y"),
+    GVAR_ENTRY("boolmat.cpp", BOOLEAN_MAT_HASH, 2, "x, data"),
     GVAR_ENTRY("isomorph.cpp", PermuteMultiplicationTableNC, 3, "temp, M, p"),
     GVAR_ENTRY("isomorph.cpp", PermuteMultiplicationTable, 3, "temp, M, p"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE, 1, "table"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE_BUFFER, 1, "ct"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE_SIZE, 1, "ct"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE_EXPAND, 1, "ct"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE_EQ, 2, "x, y"),
+    GVAR_ENTRY("isomorph.cpp", COMPACT_MULT_TABLE_LT, 2, "x, y"),
+    GVAR_ENTRY("isomorph.cpp", SMALLEST_MULT_TABLE, 2, "ct, nr_threads"),
+    GVAR_ENTRY("isomorph.cpp", SMALLEST_MULT_TABLES, 2, "tables, nr_threads"),
+    GVAR_ENTRY("isomorph.cpp", SEMIGROUP_INVARIANT_FINGERPRINT, 1, "ct"),
+    GVAR_ENTRY("isomorph.cpp", MULT_TABLE_DIGRAPH, 2, "ct, small"),
+    GVAR_ENTRY("lambda-rho.cpp",
+               IMAGE_SET_TRANS_INT_SCRATCH,
+               3,
+               "buf, f, n"),
+    GVAR_ENTRY("lambda-rho.cpp",
+               FLAT_KERNEL_TRANS_INT_SCRATCH,
+               3,
+               "buf, f, n"),
+    GVAR_ENTRY("maxplusmat.cpp", MAX_PLUS_MAT_PROD, 2, "x, y"),
+    GVAR_ENTRY("maxplusmat.cpp", MIN_PLUS_MAT_PROD, 2, "x, y"),
+    GVAR_ENTRY("maxplusmat.cpp",
+               TROPICAL_MAX_PLUS_MAT_PROD,
+               3,
+               "x, y, threshold"),
+    GVAR_ENTRY("maxplusmat.cpp",
+               TROPICAL_MIN_PLUS_MAT_PROD,
+               3,
+               "x, y, threshold"),
+    GVAR_ENTRY("maxplusmat.cpp", PROJ_MAX_PLUS_MAT_PROD, 2, "x, y"),
+    GVAR_ENTRY("maxplusmat.cpp",
+               NTP_MAT_PROD,
+               4,
+               "x, y, threshold, period"),
+    GVAR_ENTRY("pbr.cpp", PBR_PROD, 2, "x, y"),
+    GVAR_ENTRY("pbr.cpp", PBR_EQ, 2, "x, y"),
+    GVAR_ENTRY("pbr.cpp", PBR_LT, 2, "x, y"),
+    GVAR_ENTRY("pbr.cpp", PBR_HASH, 2, "x, data"),
+    GVAR_ENTRY("stabchain.cpp", STAB_CHAIN_CONTAINS, 2, "stab, x"),
+    GVAR_ENTRY("tietze.cpp",
+               STZ_REPLACE_SUBWORD,
+               3,
+               "word, subword, new_word"),
+    GVAR_ENTRY("tietze.cpp", STZ_COUNT_SUBWORD, 2, "rels, subword"),
+    GVAR_ENTRY("tietze.cpp", STZ_FREQUENT_SUBWORD, 1, "rels"),
 
     {0, 0, 0, 0, 0} /* Finish with an empty entry */
 };
@@ -476,6 +545,11 @@ static Int InitKernel(StructInitInfo* module) {
   ImportGVarFromLibrary("IsDigraph", &IsDigraph);
   ImportGVarFromLibrary("OutNeighbours", &OutNeighbours);
 
+  ImportGVarFromLibrary("IsCompactMultiplicationTable",
+                        &IsCompactMultiplicationTable);
+  ImportGVarFromLibrary("CompactMultiplicationTableType",
+                        &CompactMultiplicationTableType);
+
   ImportGVarFromLibrary("IsSemigroup", &IsSemigroup);
   ImportGVarFromLibrary("IsMatrixObj", &IsMatrixObj);
   ImportGVarFromLibrary("BaseDomain", &BaseDomain);
@@ -33,6 +33,8 @@
 
 #include "gapbind14/gapbind14.hpp"
 
+#include "libsemigroups/kambites.hpp"      // for Kambites
+#include "libsemigroups/knuth-bendix.hpp"  // for KnuthBendix
 #include "libsemigroups/sims.hpp"          // for Sims
 #include "libsemigroups/todd-coxeter.hpp"  // for ToddCoxeter
 #include "libsemigroups/types.hpp"         // for word_type, congruence_kind
@@ -76,6 +78,9 @@ extern Obj IsDigraph;
 extern Obj DigraphNrVertices;
 extern Obj OutNeighbours;
 
+extern Obj IsCompactMultiplicationTable;
+extern Obj CompactMultiplicationTableType;
+
 extern Obj IsSemigroup;
 extern Obj IsMatrixObj;
 extern Obj BaseDomain;
@@ -89,6 +94,14 @@ namespace gapbind14 {
   struct IsGapBind14Type<libsemigroups::ToddCoxeter<libsemigroups::word_type>>
       : std::true_type {};
 
+  template <>
+  struct IsGapBind14Type<libsemigroups::KnuthBendix<libsemigroups::word_type>>
+      : std::true_type {};
+
+  template <>
+  struct IsGapBind14Type<libsemigroups::Kambites<libsemigroups::word_type>>
+      : std::true_type {};
+
   template <>
   struct IsGapBind14Type<libsemigroups::Presentation<libsemigroups::word_type>>
       : std::true_type {};
@@ -109,6 +122,16 @@ namespace gapbind14 {
   template <>
   struct IsGapBind14Type<libsemigroups::RepOrc> : std::true_type {};
 
+  template <>
+  struct IsGapBind14Type<libsemigroups::Sims2> : std::true_type {};
+
+  template <>
+  struct IsGapBind14Type<typename libsemigroups::Sims2::iterator>
+      : std::true_type {};
+
+  template <>
+  struct IsGapBind14Type<libsemigroups::MinimalRepOrc> : std::true_type {};
+
 }  // namespace gapbind14
 
 #endif  // SEMIGROUPS_SRC_PKG_HPP_
@@ -0,0 +1,141 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+#include "stabchain.hpp"
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+// GAP headers
+#include "gap_all.h"  // for Obj, CONST_ADDR_PERM2, DEG_PERM2, ...
+
+namespace {
+  Int RNam_generators  = 0;
+  Int RNam_orbit       = 0;
+  Int RNam_transversal = 0;
+  Int RNam_stabilizer  = 0;
+
+  inline void init_rnams() {
+    if (RNam_generators == 0) {
+      RNam_generators  = RNamName("generators");
+      RNam_orbit       = RNamName("orbit");
+      RNam_transversal = RNamName("transversal");
+      RNam_stabilizer  = RNamName("stabilizer");
+    }
+  }
+
+  inline bool is_perm(Obj x) {
+    return TNUM_OBJ(x) == T_PERM2 || TNUM_OBJ(x) == T_PERM4;
+  }
+
+  // The images of the (0-based) points under the permutation sifted so far,
+  // reused between calls.
+  std::vector<UInt4> _img;
+
+  // Points not in _img are fixed by the permutation being sifted, so that
+  // _img can be extended on demand when it is multiplied by a permutation of
+  // larger degree.
+  void resize(size_t n) {
+    for (size_t i = _img.size(); i < n; ++i) {
+      _img.push_back(i);
+    }
+  }
+
+  template <typename T>
+  void assign(T const* ptp, UInt deg) {
+    _img.assign(ptp, ptp + deg);
+  }
+
+  // Replace _img by _img * p (i.e. apply _img and then p).
+  template <typename T>
+  void multiply(T const* ptp, UInt deg) {
+    resize(deg);
+    for (auto& i : _img) {
+      if (i < deg) {
+        i = ptp[i];
+      }
+    }
+  }
+
+  void multiply(Obj p) {
+    if (TNUM_OBJ(p) == T_PERM2) {
+      multiply(CONST_ADDR_PERM2(p), DEG_PERM2(p));
+    } else {
+      multiply(CONST_ADDR_PERM4(p), DEG_PERM4(p));
+    }
+  }
+
+  // The (0-based) image of the (0-based) point i under p.
+  UInt image(Obj p, UInt i) {
+    if (TNUM_OBJ(p) == T_PERM2) {
+      return (i < DEG_PERM2(p) ? CONST_ADDR_PERM2(p)[i] : i);
+    }
+    return (i < DEG_PERM4(p) ? CONST_ADDR_PERM4(p)[i] : i);
+  }
+
+  bool is_one() {
+    for (size_t i = 0; i < _img.size(); ++i) {
+      if (_img[i] != i) {
+        return false;
+      }
+    }
+    return true;
+  }
+}  // namespace
+
+// Returns true if the permutation <x> belongs to the group with stabiliser
+// chain <stab>, and false if not. This is equivalent to
+// SiftedPermutation(stab, x) = (), but the permutation being sifted is
+// multiplied in place by the transversal elements.
+
+Obj STAB_CHAIN_CONTAINS(Obj self, Obj stab, Obj x) {
+  if (!IS_PREC(stab)) {
+    ErrorQuit("the 1st argument must be a stabilizer chain, found a %s",
+              (Int) TNAM_OBJ(stab),
+              0L);
+  } else if (!is_perm(x)) {
+    ErrorQuit("the 2nd argument must be a permutation, found a %s",
+              (Int) TNAM_OBJ(x),
+              0L);
+  }
+  init_rnams();
+
+  if (TNUM_OBJ(x) == T_PERM2) {
+    assign(CONST_ADDR_PERM2(x), DEG_PERM2(x));
+  } else {
+    assign(CONST_ADDR_PERM4(x), DEG_PERM4(x));
+  }
+
+  while (LEN_LIST(ElmPRec(stab, RNam_generators)) != 0) {
+    UInt const bpt = INT_INTOBJ(ELM_LIST(ElmPRec(stab, RNam_orbit), 1)) - 1;
+    UInt       img = (bpt < _img.size() ? _img[bpt] : bpt);
+    Obj const  trans = ElmPRec(stab, RNam_transversal);
+    if (static_cast<Int>(img) >= LEN_LIST(trans)
+        || !ISB_LIST(trans, img + 1)) {
+      return False;
+    }
+    while (img != bpt) {
+      Obj const t = ELM_LIST(trans, img + 1);
+      multiply(t);
+      img = image(t, img);
+    }
+    stab = ElmPRec(stab, RNam_stabilizer);
+  }
+  return (is_one() ? True : False);
+}
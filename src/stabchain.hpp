@@ -0,0 +1,32 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+
+// This file contains a kernel function for sifting a permutation through a
+// stabiliser chain, as returned by StabChainImmutable, without allocating any
+// intermediate permutations. This is used to test membership in the
+// Schutzenberger groups of acting semigroups, see SchutzGpMembership.
+
+#ifndef SEMIGROUPS_SRC_STABCHAIN_HPP_
+#define SEMIGROUPS_SRC_STABCHAIN_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj STAB_CHAIN_CONTAINS(Obj self, Obj stab, Obj x);
+
+#endif  // SEMIGROUPS_SRC_STABCHAIN_HPP_
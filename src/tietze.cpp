@@ -0,0 +1,238 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "tietze.hpp"
+
+#include <algorithm>  // for equal, max
+#include <cstddef>    // for size_t
+#include <vector>     // for vector
+
+#include "gap_all.h"  // for Obj, ELM_LIST, LEN_LIST, ...
+
+namespace {
+  using word_type = std::vector<Int>;
+
+  // The following functions check their arguments before any C++ objects are
+  // created, since ErrorQuit leaves the current function by longjmp, which
+  // does not call destructors.
+  void check_word(Obj list) {
+    if (!IS_SMALL_LIST(list)) {
+      ErrorQuit("expected a list of positive integers, found a %s",
+                (Int) TNAM_OBJ(list),
+                0L);
+    }
+    Int const n = LEN_LIST(list);
+    for (Int i = 1; i <= n; ++i) {
+      Obj x = ELM_LIST(list, i);
+      if (!IS_POS_INTOBJ(x)) {
+        ErrorQuit("expected a list of positive integers, found a %s in "
+                  "position %d",
+                  (Int) TNAM_OBJ(x),
+                  (Int) i);
+      }
+    }
+  }
+
+  void check_rels(Obj rels) {
+    if (!IS_SMALL_LIST(rels)) {
+      ErrorQuit("expected a list of relations, found a %s",
+                (Int) TNAM_OBJ(rels),
+                0L);
+    }
+    Int const n = LEN_LIST(rels);
+    for (Int i = 1; i <= n; ++i) {
+      Obj rel = ELM_LIST(rels, i);
+      if (!IS_SMALL_LIST(rel) || LEN_LIST(rel) != 2) {
+        ErrorQuit("expected a relation (a list of length 2) in position %d",
+                  (Int) i,
+                  0L);
+      }
+      check_word(ELM_LIST(rel, 1));
+      check_word(ELM_LIST(rel, 2));
+    }
+  }
+
+  // <list> must have been checked by check_word.
+  word_type to_word(Obj list) {
+    size_t const n = LEN_LIST(list);
+    word_type    result;
+    result.reserve(n);
+    for (size_t i = 1; i <= n; ++i) {
+      result.push_back(INT_INTOBJ(ELM_LIST(list, i)));
+    }
+    return result;
+  }
+
+  // Returns the words in the relations <rels> (a list of pairs of words
+  // checked by check_rels) in the order rels[1][1], rels[1][2], rels[2][1],
+  // ...
+  std::vector<word_type> to_words(Obj rels) {
+    size_t const           n = LEN_LIST(rels);
+    std::vector<word_type> result;
+    result.reserve(2 * n);
+    for (size_t i = 1; i <= n; ++i) {
+      Obj rel = ELM_LIST(rels, i);
+      result.push_back(to_word(ELM_LIST(rel, 1)));
+      result.push_back(to_word(ELM_LIST(rel, 2)));
+    }
+    return result;
+  }
+
+  Obj word_to_gap(word_type::const_iterator first,
+                  word_type::const_iterator last) {
+    size_t const n      = last - first;
+    Obj          result = NEW_PLIST(n == 0 ? T_PLIST_EMPTY : T_PLIST_CYC, n);
+    SET_LEN_PLIST(result, n);
+    for (size_t i = 1; i <= n; ++i, ++first) {
+      SET_ELM_PLIST(result, i, INTOBJ_INT(*first));
+    }
+    return result;
+  }
+
+  bool is_prefix(word_type const&          subword,
+                 word_type::const_iterator first,
+                 word_type::const_iterator last) {
+    return static_cast<size_t>(last - first) >= subword.size()
+           && std::equal(subword.cbegin(), subword.cend(), first);
+  }
+
+  // Returns the number of non-overlapping occurrences of the non-empty word
+  // [first, last) in <words>, found by reading every word from left to right.
+  size_t count_subword(std::vector<word_type> const& words,
+                       word_type::const_iterator     first,
+                       word_type::const_iterator     last) {
+    size_t const k     = last - first;
+    size_t       count = 0;
+    for (auto const& w : words) {
+      if (w.size() < k) {
+        continue;
+      }
+      size_t i = 0;
+      while (i + k <= w.size()) {
+        if (std::equal(first, last, w.cbegin() + i)) {
+          ++count;
+          i += k;
+        } else {
+          ++i;
+        }
+      }
+    }
+    return count;
+  }
+}  // namespace
+
+// Returns the word obtained from <word> by replacing every (non-overlapping,
+// leftmost) occurrence of the non-empty word <subword> by <new_word>.
+Obj STZ_REPLACE_SUBWORD(Obj self, Obj word, Obj subword, Obj new_word) {
+  check_word(word);
+  check_word(subword);
+  check_word(new_word);
+  if (LEN_LIST(subword) == 0) {
+    ErrorQuit("the 2nd argument (a list) must be non-empty", 0L, 0L);
+  }
+  word_type const w   = to_word(word);
+  word_type const sub = to_word(subword);
+  word_type const rep = to_word(new_word);
+  word_type result;
+  result.reserve(w.size());
+  auto it = w.cbegin();
+  while (it != w.cend()) {
+    if (is_prefix(sub, it, w.cend())) {
+      result.insert(result.end(), rep.cbegin(), rep.cend());
+      it += sub.size();
+    } else {
+      result.push_back(*it++);
+    }
+  }
+  return word_to_gap(result.cbegin(), result.cend());
+}
+
+// Returns the total number of non-overlapping occurrences of the non-empty
+// word <subword> in the sides of the relations <rels>.
+Obj STZ_COUNT_SUBWORD(Obj self, Obj rels, Obj subword) {
+  check_rels(rels);
+  check_word(subword);
+  if (LEN_LIST(subword) == 0) {
+    ErrorQuit("the 2nd argument (a list) must be non-empty", 0L, 0L);
+  }
+  word_type const sub = to_word(subword);
+  return INTOBJ_INT(count_subword(to_words(rels), sub.cbegin(), sub.cend()));
+}
+
+// Returns a list [gain, word] where <word> is the first subword of length at
+// least 2 of a side of a relation in <rels> (in the order they occur) such
+// that replacing all of its occurrences by a new generator reduces the length
+// of the presentation by the maximum amount <gain>, or [0, []] if no subword
+// reduces the length. A subword of length k that occurs c times yields a gain
+// of (c - 1) * (k - 1) - 3, for the new generator and relation. Since c is at
+// most the sum of |w| / k over all words w, most subwords can be discarded
+// without being counted.
+Obj STZ_FREQUENT_SUBWORD(Obj self, Obj rels) {
+  check_rels(rels);
+  std::vector<word_type> const words = to_words(rels);
+
+  size_t max_len = 0;
+  for (auto const& w : words) {
+    max_len = std::max(max_len, w.size());
+  }
+  // bound[k] is an upper bound for the number of occurrences of a word of
+  // length k
+  std::vector<Int> bound(max_len + 1, 0);
+  for (size_t k = 1; k <= max_len; ++k) {
+    for (auto const& w : words) {
+      bound[k] += w.size() / k;
+    }
+  }
+
+  Int  best_gain = 0;
+  auto best      = words.cend();
+  auto best_i    = word_type::const_iterator();
+  auto best_j    = word_type::const_iterator();
+
+  for (auto w = words.cbegin(); w != words.cend(); ++w) {
+    // The subword [i, i + k) of *w for 0 <= i and 2 <= k <= |w| - i
+    for (size_t i = 0; i + 2 <= w->size(); ++i) {
+      for (size_t k = 2; i + k <= w->size(); ++k) {
+        if ((bound[k] - 1) * (static_cast<Int>(k) - 1) - 3 <= best_gain) {
+          continue;
+        }
+        auto const first = w->cbegin() + i;
+        auto const last  = first + k;
+        Int const  c     = count_subword(words, first, last);
+        Int const  gain  = (c - 1) * (static_cast<Int>(k) - 1) - 3;
+        if (gain > best_gain) {
+          best_gain = gain;
+          best      = w;
+          best_i    = first;
+          best_j    = last;
+        }
+      }
+    }
+  }
+
+  Obj result = NEW_PLIST(T_PLIST, 2);
+  SET_LEN_PLIST(result, 2);
+  SET_ELM_PLIST(result, 1, INTOBJ_INT(best_gain));
+  if (best == words.cend()) {
+    SET_ELM_PLIST(result, 2, NEW_PLIST(T_PLIST_EMPTY, 0));
+  } else {
+    SET_ELM_PLIST(result, 2, word_to_gap(best_i, best_j));
+  }
+  CHANGED_BAG(result);
+  return result;
+}
@@ -0,0 +1,32 @@
+//
+// Semigroups package for GAP
+// Copyright (C) 2026 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+// This file contains declarations of kernel functions used by the Tietze
+// transformations for IsStzPresentation objects (gap/fp/tietze.gi), where the
+// words in the relations are lists of positive integers.
+
+#ifndef SEMIGROUPS_SRC_TIETZE_HPP_
+#define SEMIGROUPS_SRC_TIETZE_HPP_
+
+#include "gap_all.h"  // for Obj
+
+Obj STZ_REPLACE_SUBWORD(Obj self, Obj word, Obj subword, Obj new_word);
+Obj STZ_COUNT_SUBWORD(Obj self, Obj rels, Obj subword);
+Obj STZ_FREQUENT_SUBWORD(Obj self, Obj rels);
+
+#endif  // SEMIGROUPS_SRC_TIETZE_HPP_
@@ -29,6 +29,7 @@
 #include <cstdint>        // for uint32_t
 #include <memory>         // for make_unique, unique_ptr
 #include <string>         // for string
+#include <string_view>    // for string_view
 #include <type_traits>    // for decay_t, is_same, conditional_t
 #include <unordered_map>  // for operator==, unordered_map
 #include <utility>        // for forward
@@ -50,15 +51,17 @@
 #include "gapbind14/to_gap.hpp"  // for gap_tnum_type
 
 // libsemigroups headers
-#include "libsemigroups/adapters.hpp"   // for Degree
-#include "libsemigroups/bmat8.hpp"      // for BMat8
-#include "libsemigroups/config.hpp"     // for LIBSEMIGROUPS_HPCOMBI_ENABLED
-#include "libsemigroups/cong.hpp"       // for Congruence
-#include "libsemigroups/constants.hpp"  // for NegativeInfinity, PositiveIn...
-#include "libsemigroups/matrix.hpp"     // for NTPMat, MaxPlusTruncMat, Min...
-#include "libsemigroups/pbr.hpp"        // for PBR
-#include "libsemigroups/transf.hpp"     // for PPerm, Transf, IsPPerm
-#include "libsemigroups/types.hpp"      // for congruence_kind, congruence_...
+#include "libsemigroups/adapters.hpp"            // for Degree
+#include "libsemigroups/bmat8.hpp"               // for BMat8
+#include "libsemigroups/config.hpp"              // for LIBSEMIGROUPS_HPCOMBI...
+#include "libsemigroups/cong.hpp"                // for Congruence
+#include "libsemigroups/constants.hpp"           // for NegativeInfinity, ...
+#include "libsemigroups/knuth-bendix-class.hpp"  // for KnuthBendix
+#include "libsemigroups/matrix.hpp"              // for NTPMat, MaxPlusTrun...
+#include "libsemigroups/pbr.hpp"                 // for PBR
+#include "libsemigroups/todd-coxeter-class.hpp"  // for ToddCoxeter
+#include "libsemigroups/transf.hpp"              // for PPerm, Transf, IsPPerm
+#include "libsemigroups/types.hpp"               // for congruence_kind, co...
 
 #include "libsemigroups/detail/containers.hpp"  // for DynamicArray2
 
@@ -97,6 +100,11 @@ using libsemigroups::detail::DynamicArray2;
 
 using libsemigroups::WordGraph;
 
+using ToddCoxeterOptions =
+    typename libsemigroups::ToddCoxeter<libsemigroups::word_type>::options;
+using KnuthBendixOptions =
+    typename libsemigroups::KnuthBendix<libsemigroups::word_type>::options;
+
 namespace semigroups {
   NTPSemiring<> const* semiring(size_t threshold, size_t period);
 
@@ -121,7 +129,7 @@ namespace gapbind14 {
     using cpp_type                          = PositiveInfinity;
     static gap_tnum_type constexpr gap_type = T_POSOBJ;
     auto operator()(Obj x) const {
-      if (CALL_1ARGS(IsInfinity, x) != True) {
+      if (x != Pinfinity && CALL_1ARGS(IsInfinity, x) != True) {
         ErrorQuit("expected object satisfying IsInfinity, found %s",
                   (Int) TNAM_OBJ(x),
                   0L);
@@ -135,7 +143,7 @@ namespace gapbind14 {
     using cpp_type                          = NegativeInfinity;
     static gap_tnum_type constexpr gap_type = T_POSOBJ;
     auto operator()(Obj x) const {
-      if (CALL_1ARGS(IsNegInfinity, x) != True) {
+      if (x != Ninfinity && CALL_1ARGS(IsNegInfinity, x) != True) {
         ErrorQuit("expected object satisfying IsNegInfinity, found %s",
                   (Int) TNAM_OBJ(x),
                   0L);
@@ -242,15 +250,20 @@ namespace gapbind14 {
         for (size_t j = 0; j < m; j++) {
           Obj         val = ELM_PLIST(row, j + 1);
           scalar_type itm;
-          if (CALL_1ARGS(IsInfinity, val) != True
-              && CALL_1ARGS(IsNegInfinity, val) != True) {
+          // infinity and -infinity are the unique objects Pinfinity and
+          // Ninfinity, and so we only call into GAP for other objects.
+          if (IS_INTOBJ(val)) {
             itm = to_cpp<scalar_type>()(val);
-          } else if (CALL_1ARGS(IsInfinity, val) == True) {
+          } else if (val == Pinfinity
+                     || CALL_1ARGS(IsInfinity, val) == True) {
             itm = to_cpp<PositiveInfinity>()(val);
-          } else if (CALL_1ARGS(IsNegInfinity, val) == True) {
+          } else if (val == Ninfinity
+                     || CALL_1ARGS(IsNegInfinity, val) == True) {
             itm = to_cpp<std::conditional_t<std::is_signed<scalar_type>::value,
                                             NegativeInfinity,
                                             scalar_type>>()(val);
+          } else {
+            itm = to_cpp<scalar_type>()(val);
           }
           x(i, j) = itm;
         }
@@ -428,6 +441,130 @@ namespace gapbind14 {
     }
   };
 
+  ////////////////////////////////////////////////////////////////////////
+  // ToddCoxeter + KnuthBendix settings
+  ////////////////////////////////////////////////////////////////////////
+
+  namespace detail {
+    inline std::string_view enum_string(Obj o) {
+      if (TNUM_OBJ(o) != T_STRING && TNUM_OBJ(o) != T_STRING + IMMUTABLE) {
+        ErrorQuit("expected string but got %s!", (Int) TNAM_OBJ(o), 0L);
+      }
+      return CSTR_STRING(o);
+    }
+  }  // namespace detail
+
+  template <>
+  struct to_cpp<ToddCoxeterOptions::strategy> {
+    using cpp_type                          = ToddCoxeterOptions::strategy;
+    static gap_tnum_type constexpr gap_type = T_STRING;
+
+    cpp_type operator()(Obj o) const {
+      std::string_view stype = detail::enum_string(o);
+      if (stype == "hlt") {
+        return cpp_type::hlt;
+      } else if (stype == "felsch") {
+        return cpp_type::felsch;
+      } else if (stype == "CR") {
+        return cpp_type::CR;
+      } else if (stype == "R/C") {
+        return cpp_type::R_over_C;
+      } else if (stype == "Cr") {
+        return cpp_type::Cr;
+      } else if (stype == "Rc") {
+        return cpp_type::Rc;
+      } else {
+        ErrorQuit("Unrecognised strategy %s, expected one of \"hlt\", "
+                  "\"felsch\", \"CR\", \"R/C\", \"Cr\", or \"Rc\"",
+                  (Int) stype.begin(),
+                  0L);
+      }
+    }
+  };
+
+  template <>
+  struct to_cpp<ToddCoxeterOptions::lookahead_extent> {
+    using cpp_type = ToddCoxeterOptions::lookahead_extent;
+    static gap_tnum_type constexpr gap_type = T_STRING;
+
+    cpp_type operator()(Obj o) const {
+      std::string_view stype = detail::enum_string(o);
+      if (stype == "full") {
+        return cpp_type::full;
+      } else if (stype == "partial") {
+        return cpp_type::partial;
+      } else {
+        ErrorQuit("Unrecognised lookahead extent %s, expected \"full\" or "
+                  "\"partial\"",
+                  (Int) stype.begin(),
+                  0L);
+      }
+    }
+  };
+
+  template <>
+  struct to_cpp<ToddCoxeterOptions::lookahead_style> {
+    using cpp_type = ToddCoxeterOptions::lookahead_style;
+    static gap_tnum_type constexpr gap_type = T_STRING;
+
+    cpp_type operator()(Obj o) const {
+      std::string_view stype = detail::enum_string(o);
+      if (stype == "hlt") {
+        return cpp_type::hlt;
+      } else if (stype == "felsch") {
+        return cpp_type::felsch;
+      } else {
+        ErrorQuit("Unrecognised lookahead style %s, expected \"hlt\" or "
+                  "\"felsch\"",
+                  (Int) stype.begin(),
+                  0L);
+      }
+    }
+  };
+
+  template <>
+  struct to_cpp<ToddCoxeterOptions::def_policy> {
+    using cpp_type                          = ToddCoxeterOptions::def_policy;
+    static gap_tnum_type constexpr gap_type = T_STRING;
+
+    cpp_type operator()(Obj o) const {
+      std::string_view stype = detail::enum_string(o);
+      if (stype == "purge_from_top") {
+        return cpp_type::purge_from_top;
+      } else if (stype == "purge_all") {
+        return cpp_type::purge_all;
+      } else if (stype == "discard_all_if_no_space") {
+        return cpp_type::discard_all_if_no_space;
+      } else if (stype == "unlimited") {
+        return cpp_type::unlimited;
+      } else {
+        ErrorQuit("Unrecognised definition policy %s", (Int) stype.begin(), 0L);
+      }
+    }
+  };
+
+  template <>
+  struct to_cpp<KnuthBendixOptions::overlap> {
+    using cpp_type                          = KnuthBendixOptions::overlap;
+    static gap_tnum_type constexpr gap_type = T_STRING;
+
+    cpp_type operator()(Obj o) const {
+      std::string_view stype = detail::enum_string(o);
+      if (stype == "ABC") {
+        return cpp_type::ABC;
+      } else if (stype == "AB_BC") {
+        return cpp_type::AB_BC;
+      } else if (stype == "MAX_AB_BC") {
+        return cpp_type::MAX_AB_BC;
+      } else {
+        ErrorQuit("Unrecognised overlap policy %s, expected one of \"ABC\", "
+                  "\"AB_BC\", or \"MAX_AB_BC\"",
+                  (Int) stype.begin(),
+                  0L);
+      }
+    }
+  };
+
   ////////////////////////////////////////////////////////////////////////
   // Transformations
   ////////////////////////////////////////////////////////////////////////
@@ -457,14 +457,20 @@ namespace gapbind14 {
 
   template <>
   struct to_gap<libsemigroups::PBR> {
-    Obj operator()(libsemigroups::PBR x) const {
+    Obj operator()(libsemigroups::PBR const& x) const {
       Obj result = NEW_PLIST(T_PLIST, 2 * x.degree() + 1);
       // can't use T_PLIST_TAB/HOM here because some of the subplists might be
       // empty
       SET_LEN_PLIST(result, 2 * x.degree() + 1);
       SET_ELM_PLIST(result, 1, INTOBJ_INT(x.degree()));
       for (uint32_t i = 0; i < 2 * x.degree(); i++) {
-        Obj next = SUM(to_gap<std::vector<uint32_t>>()(x[i]), INTOBJ_INT(1));
+        auto const& adj  = x[i];
+        Obj         next = NEW_PLIST(adj.empty() ? T_PLIST_EMPTY : T_PLIST_CYC,
+                                     adj.size());
+        SET_LEN_PLIST(next, adj.size());
+        for (size_t j = 0; j < adj.size(); ++j) {
+          SET_ELM_PLIST(next, j + 1, INTOBJ_INT(adj[j] + 1));
+        }
         SET_ELM_PLIST(result, i + 2, next);
         CHANGED_BAG(result);
       }
@@ -9,7 +9,8 @@
 ##
 
 #@local A, BruteForceInverseCheck, BruteForceIsoCheck, F, G, S, T, U, V, inv
-#@local map, x, y, M, N, R, L, OldOnMultiplicationTable, p, out
+#@local map, x, y, M, N, R, L, OldOnMultiplicationTable, p, out, table, C
+#@local coll, D, BruteForceSmallest
 gap> START_TEST("Semigroups package: standard/attributes/isomorph.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -479,6 +480,163 @@ gap> OnMultiplicationTable([[1, 3], [1, 2]], (1, 2));
 Error, all entries in the second argument <table> must be positive integers fr\
 om 1 to Size(<table>) = 2
 
+# CompactMultiplicationTable
+gap> S := SymmetricInverseMonoid(3);;
+gap> table := MultiplicationTable(S);;
+gap> C := CompactMultiplicationTable(S);
+<compact 34x34 multiplication table>
+gap> IsCompactMultiplicationTable(C);
+true
+gap> ExpandedMultiplicationTable(C) = table;
+true
+gap> CompactMultiplicationTable(table) = C;
+true
+gap> p := (1, 34, 2)(5, 17);;
+gap> ExpandedMultiplicationTable(OnMultiplicationTable(C, p))
+> = OnMultiplicationTable(table, p);
+true
+gap> out := ShallowCopy(C);;
+gap> out = C;
+true
+gap> PermuteMultiplicationTable(out, C, p);
+gap> out = OnMultiplicationTable(C, p);
+true
+gap> PermuteMultiplicationTableNC(out, C, p ^ -1);
+gap> ExpandedMultiplicationTable(out) = OnMultiplicationTable(table, p ^ -1);
+true
+gap> ForAll(SymmetricGroup(4),
+> p -> (C < OnMultiplicationTable(C, p))
+>      = (table < OnMultiplicationTable(table, p)));
+true
+gap> table := List([1 .. 300], i -> List([1 .. 300], j -> Maximum(i, j)));;
+gap> C := CompactMultiplicationTable(table);
+<compact 300x300 multiplication table>
+gap> p := (1, 300)(2, 299, 150);;
+gap> ExpandedMultiplicationTable(OnMultiplicationTable(C, p))
+> = OnMultiplicationTable(table, p);
+true
+gap> OnMultiplicationTable(C, p) = C;
+false
+gap> PermuteMultiplicationTable(C, C, p);
+Error, the arguments <output> and <table> must be distinct objects
+gap> PermuteMultiplicationTable(ShallowCopy(C), C, (1, 301));
+Error, the argument <p> must map [1 .. 300] to itself
+gap> PermuteMultiplicationTable(1, C, ());
+Error, the argument <output> must be a compact multiplication table, but found\
+ integer
+gap> PermuteMultiplicationTable(CompactMultiplicationTable(S), C, ());
+Error, the argument <output> must be mutable
+gap> CompactMultiplicationTable([[1, 3], [1, 2]]);
+Error, all entries in the argument <table> must be positive integers from 1 to\
+ Size(<table>) = 2
+
+# SmallestMultiplicationTable, in parallel and after relabelling
+gap> S := SymmetricInverseMonoid(2);;
+gap> C := CompactMultiplicationTable(S);;
+gap> table := ExpandedMultiplicationTable(SMALLEST_MULT_TABLE(C, 1));;
+gap> table = SmallestMultiplicationTable(S);
+true
+gap> ForAll([(1, 2, 3), (1, 7)(5, 6), (2, 6, 4, 7)],
+> p -> table = ExpandedMultiplicationTable(
+>              SMALLEST_MULT_TABLE(OnMultiplicationTable(C, p), 4)));
+true
+gap> SMALLEST_MULT_TABLE(C, 0);
+Error, the argument <nr_threads> must be a positive integer, but found integer
+
+# SmallestMultiplicationTable, compared with the result of an exhaustive
+# search, for semigroups with many automorphisms and repeated diagonal entries
+gap> BruteForceSmallest := function(S)
+>   local table, best, key, p;
+>   table := MultiplicationTable(S);
+>   best := fail;
+>   for p in SymmetricGroup(Length(table)) do
+>     key := OnMultiplicationTable(table, p);
+>     key := [DiagonalOfMat(key), key];
+>     if best = fail or key < best then
+>       best := key;
+>     fi;
+>   od;
+>   return best[2];
+> end;;
+gap> coll := [LeftZeroSemigroup(4), ZeroSemigroup(5), RectangularBand(2, 3),
+>             AsSemigroup(IsTransformationSemigroup, Group((1, 2), (3, 4))),
+>             Semigroup([Transformation([2, 1, 3]), Transformation([1, 1, 1])]),
+>             MonogenicSemigroup(3, 2)];;
+gap> ForAll(coll, S -> SmallestMultiplicationTable(S) = BruteForceSmallest(S));
+true
+gap> ForAll(coll,
+> S -> SmallestMultiplicationTable(S) = ExpandedMultiplicationTable(
+>      SMALLEST_MULT_TABLE(CompactMultiplicationTable(S), 4)));
+true
+gap> List(SMALLEST_MULT_TABLES(List(coll, CompactMultiplicationTable), 3),
+>         ExpandedMultiplicationTable)
+> = List(coll, SmallestMultiplicationTable);
+true
+gap> SMALLEST_MULT_TABLES([C, 1], 2);
+Error, the argument <table> must be a compact multiplication table, but found \
+integer
+
+# SemigroupInvariantFingerprint
+gap> S := FullTransformationMonoid(3);;
+gap> SemigroupInvariantFingerprint(S){[1 .. 6]};
+[ 27, 10, 141, 5, 7, 13 ]
+gap> SemigroupInvariantFingerprint(S)[8];
+[ 3, 6, 18 ]
+gap> SemigroupInvariantFingerprint(S)
+> = SemigroupInvariantFingerprint(AsSemigroup(IsBipartitionSemigroup, S));
+true
+gap> SemigroupInvariantFingerprint(LeftZeroSemigroup(3))
+> = SemigroupInvariantFingerprint(RightZeroSemigroup(3));
+false
+gap> SemigroupInvariantFingerprint(FreeSemigroup(2));
+Error, the argument (a semigroup) is not finite
+
+# DeduplicateUpToIsomorphism
+gap> S := SymmetricInverseMonoid(2);;
+gap> coll := [S, LeftZeroSemigroup(7), AsSemigroup(IsBooleanMatSemigroup, S),
+>             RightZeroSemigroup(7), FullTransformationMonoid(2),
+>             AsSemigroup(IsTransformationSemigroup, LeftZeroSemigroup(7)),
+>             AsSemigroup(IsPBRSemigroup, FullTransformationMonoid(2))];;
+gap> DeduplicateUpToIsomorphism(coll) = coll{[1, 2, 4, 5]};
+true
+gap> coll := [FullTransformationMonoid(3),
+>             AsSemigroup(IsBipartitionSemigroup, FullTransformationMonoid(3)),
+>             AsSemigroup(IsPBRSemigroup, FullTransformationMonoid(3))];;
+gap> DeduplicateUpToIsomorphism(coll) = coll{[1]};
+true
+gap> DeduplicateUpToIsomorphism([]);
+[  ]
+gap> DeduplicateUpToIsomorphism([FreeSemigroup(1)]);
+Error, the argument (a list) must consist of finite semigroups
+
+# SEMIGROUPS.CanonicalDigraph
+gap> S := FullTransformationMonoid(2);;
+gap> D := SEMIGROUPS.CanonicalDigraph(S);;
+gap> [DigraphNrVertices(D[1]), DigraphNrEdges(D[1])];
+[ 24, 84 ]
+gap> D[2] = Concatenation(ListWithIdenticalEntries(4, 1),
+>                         ListWithIdenticalEntries(16, 2),
+>                         ListWithIdenticalEntries(4, 3));
+true
+gap> OutNeighbours(D[1])[1];
+[ 5, 6, 7, 8 ]
+gap> OutNeighbours(D[1])[5]{[1, 3, 4, 5]};
+[ 21, 9, 13, 17 ]
+gap> OutNeighbours(D[1])[6]{[2 .. 4]};
+[ 10, 14, 18 ]
+gap> D := SEMIGROUPS.CanonicalDigraph(S, true);;
+gap> [DigraphNrVertices(D[1]), DigraphNrEdges(D[1])];
+[ 24, 52 ]
+gap> OutNeighbours(D[1])[1];
+[ 5, 6, 7, 8, 21 ]
+gap> List(OutNeighbours(D[1]){[5 .. 8]}, x -> x[2]);
+[ 21, 22, 23, 24 ]
+gap> Size(Group(List(GeneratorsOfGroup(AutomorphismGroup(D[1], D[2])),
+>                    x -> RestrictedPerm(x, [1 .. 4]))));
+2
+gap> MULT_TABLE_DIGRAPH(CompactMultiplicationTable(S), 1);
+Error, the argument <small> must be true or false, but found integer
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/attributes/isomorph.tst");
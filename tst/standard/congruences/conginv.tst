@@ -287,6 +287,29 @@ gap> cong := SemigroupCongruence(S, pairs);
 gap> EquivalenceRelationCanonicalLookup(cong);
 [ 1, 2, 3, 4, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4 ]
 
+# KernelTraceClosure agrees with the generic method
+gap> S := SymmetricInverseMonoid(4);;
+gap> pair := [PartialPerm([1, 2], [2, 1]), PartialPerm([1, 2], [1, 2])];;
+gap> cong1 := SemigroupCongruence(S, pair);;
+gap> IsInverseSemigroupCongruenceByKernelTrace(cong1);
+true
+gap> cong2 := SemigroupCongruenceByGeneratingPairs(S, [pair]);;
+gap> EquivalenceRelationCanonicalLookup(cong1)
+> = EquivalenceRelationCanonicalLookup(cong2);
+true
+gap> ForAll(S, x -> CongruenceTestMembershipNC(cong1, x, x * pair[1])
+>                   = CongruenceTestMembershipNC(cong2, x, x * pair[1]));
+true
+gap> Size(KernelOfSemigroupCongruence(cong1))
+> = Number(S, x -> [x, x ^ -1 * x] in cong2);
+true
+gap> cong := JoinSemigroupCongruences(cong1, MinimumGroupCongruence(S));;
+gap> IsSubrelation(cong, cong1);
+true
+gap> cong := MeetSemigroupCongruences(cong1, MinimumGroupCongruence(S));;
+gap> IsSubrelation(cong1, cong);
+true
+
 # 
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/congruences/conginv.tst");
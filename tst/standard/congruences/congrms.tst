@@ -696,6 +696,36 @@ gap> Representative(RMSCongruenceClassByLinkedTriple(cong,
 > RightCoset(G, (1, 5)), 2, 3));
 (2,(),3)
 
+# CongruencesOfSemigroup: the linked triples agree with IsLinkedTriple
+gap> g := SymmetricGroup(3);;
+gap> mat := [[(), (1, 2), 0, (1, 2, 3)],
+>            [(1, 3), (2, 3), 0, ()],
+>            [0, 0, (), 0],
+>            [(), (1, 2), 0, (1, 2, 3)]];;
+gap> S := ReesZeroMatrixSemigroup(g, mat);;
+gap> congs := CongruencesOfSemigroup(S);;
+gap> ForAll(congs, C -> IsUniversalSemigroupCongruence(C)
+>                  or IsLinkedTriple(S, C!.n, C!.colBlocks, C!.rowBlocks));
+true
+gap> Number(congs, IsUniversalSemigroupCongruence);
+1
+gap> Length(congs) = 1 + Sum(NormalSubgroups(g), n ->
+>   Number(SEMIGROUPS.Subpartitions([[1, 2, 4], [3]]),
+>          c -> IsLinkedTriple(S, n, c, [[1], [2], [3], [4]]))
+>   * Number(SEMIGROUPS.Subpartitions([[1, 2, 4], [3]]),
+>            r -> IsLinkedTriple(S, n, [[1], [2], [3], [4]], r)));
+true
+gap> S := ReesMatrixSemigroup(g, [[(), (1, 2)], [(1, 3), ()], [(), (1, 2)]]);;
+gap> congs := CongruencesOfSemigroup(S);;
+gap> ForAll(congs, C -> IsLinkedTriple(S, C!.n, C!.colBlocks, C!.rowBlocks));
+true
+gap> Length(congs) = Sum(NormalSubgroups(g), n ->
+>   Number(SEMIGROUPS.Subpartitions([[1, 2]]),
+>          c -> IsLinkedTriple(S, n, c, [[1], [2], [3]]))
+>   * Number(SEMIGROUPS.Subpartitions([[1, 2, 3]]),
+>            r -> IsLinkedTriple(S, n, [[1], [2]], r)));
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/congruences/congrms.tst");
@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local BMats, S, a, b, blist, blists, c, d, e, ht, mat, x, y, z
+#@local BMats, S, a, b, blist, blists, c, d, e, ht, mat, naive, x, y, z
 gap> START_TEST("Semigroups package: standard/elements/boolmat.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -390,7 +390,7 @@ gap> Display(AsBooleanMat(x, 8));
 0 0 0 0 0 0 0 0
 0 0 0 0 0 0 0 0
 
-# boolmat: ChooseHashFunction and SEMIGROUPS_HashFunctionBooleanMat, for
+# boolmat: ChooseHashFunction and BOOLEAN_MAT_HASH, for
 # boolean mats, 1/1
 gap> S := FullBooleanMatMonoid(2);
 <monoid of 2x2 boolean matrices with 3 generators>
@@ -603,6 +603,52 @@ false
 gap> AsTransformation(z);
 fail
 
+# boolmat: product, equality, comparison, and hash in the kernel, for boolean
+# mats whose rows span more than one block
+gap> naive := function(x, y)
+>   local n, xy, i, j, k;
+>   n := Length(x![1]);
+>   xy := List([1 .. n], i -> BlistList([1 .. n], []));
+>   for i in [1 .. n] do
+>     for j in [1 .. n] do
+>       for k in [1 .. n] do
+>         if x![i][k] and y![k][j] then
+>           xy[i][j] := true;
+>           break;
+>         fi;
+>       od;
+>     od;
+>   od;
+>   return BooleanMat(xy);
+> end;;
+gap> x := BooleanMat(List([1 .. 70],
+>                         i -> List([1 .. 70], j -> (i * j + i) mod 7 = 1)));;
+gap> y := BooleanMat(List([1 .. 70],
+>                         i -> List([1 .. 70], j -> (i + 2 * j) mod 5 = 0)));;
+gap> x * y = naive(x, y);
+true
+gap> y * x = naive(y, x);
+true
+gap> (x * y) * x = x * (y * x);
+true
+gap> x < y;
+true
+gap> y < x;
+false
+gap> x < x;
+false
+gap> x = y;
+false
+gap> x = BooleanMat(List([1 .. 70], i -> List(x![i])));
+true
+gap> BOOLEAN_MAT_HASH(x, 100003)
+> = BOOLEAN_MAT_HASH(BooleanMat(List([1 .. 70], i -> List(x![i]))), 100003);
+true
+gap> x * One(x) = x;
+true
+gap> One(y) * y = y;
+true
+
 # 
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/elements/oolmat.tst");
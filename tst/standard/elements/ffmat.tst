@@ -156,6 +156,16 @@ gap> ComputeRowSpaceAndTransformation(2);
 Error, Assertion failure
 gap> ComputeRowSpaceAndTransformation(Matrix(GF(9), [[Z(9)]]));
 [ <rowbasis of rank 1 over GF(3^2)>, [ [ Z(3^2)^7 ] ], [ [ Z(3^2) ] ] ]
+gap> mat := Matrix(GF(4), [[Z(4), Z(4) ^ 2, 0 * Z(2)],
+>                          [Z(4) ^ 2, Z(2) ^ 0, 0 * Z(2)],
+>                          [0 * Z(2), 0 * Z(2), Z(2) ^ 0]]);;
+gap> x := ComputeRowSpaceAndTransformation(mat);;
+gap> x[1] = RowSpaceBasis(mat);
+true
+gap> (x[2] * Unpack(mat)){[1, 2]} = x[1]!.rows;
+true
+gap> x[2] * x[3] = IdentityMat(3, GF(4));
+true
 
 # Test Matrix, checker, 1/1
 gap> mat := Matrix(GF(5), [[0 * Z(5), Z(5) ^ 3], [Z(5) ^ 2, Z(5) ^ 0]]);
@@ -274,6 +284,42 @@ gap> HTAdd(ht, RowSpaceBasis(x), true);;
 gap> HTAdd(ht, RowSpaceBasis(ZeroMatrix(GF(4), 2, 2)), true);;
 gap> ht := HTCreate(RowSpaceBasis(ZeroMatrix(GF(4), 2, 2)));;
 gap> HTAdd(ht, RowSpaceBasis(ZeroMatrix(GF(4), 2, 2)), true);;
+gap> x := Matrix(GF(2 ^ 9), [[Z(2 ^ 9), Z(2 ^ 9) ^ 2], [0 * Z(2), Z(2) ^ 0]]);;
+gap> ht := HTCreate(RowSpaceBasis(x));;
+gap> HTAdd(ht, RowSpaceBasis(x), true);;
+gap> HTValue(ht, RowSpaceBasis(x));
+true
+
+# Row bases over small fields have compressed rows, and hash values that do
+# not depend on the representation of the rows
+gap> x := Matrix(GF(2), [[Z(2) ^ 0, Z(2) ^ 0, 0 * Z(2)],
+>                        [Z(2) ^ 0, Z(2) ^ 0, 0 * Z(2)],
+>                        [0 * Z(2), Z(2) ^ 0, Z(2) ^ 0]]);;
+gap> r1 := RowSpaceBasis(x);
+<rowbasis of rank 2 over GF(2)>
+gap> ForAll(r1!.rows, IsGF2VectorRep);
+true
+gap> r2 := NewRowBasisOverFiniteField(IsPlistRowBasisOverFiniteFieldRep,
+>                                     GF(2),
+>                                     [[Z(2) ^ 0, 0 * Z(2), Z(2) ^ 0],
+>                                      [0 * Z(2), Z(2) ^ 0, Z(2) ^ 0]]);;
+gap> r1 = r2;
+true
+gap> ht := HTCreate(r2);;
+gap> HTAdd(ht, r2, 1);;
+gap> HTValue(ht, r1);
+1
+gap> x := Matrix(GF(4), [[Z(2) ^ 0, Z(4), 0 * Z(2)],
+>                        [Z(4) ^ 2, Z(2) ^ 0, 0 * Z(2)],
+>                        [0 * Z(2), 0 * Z(2), Z(4)]]);;
+gap> ForAll(RowSpaceBasis(x)!.rows, Is8BitVectorRep);
+true
+gap> RowSpaceBasis(x) = RowSpaceBasis(x * Z(4));
+true
+gap> Size(FullMatrixMonoid(3, 2));
+512
+gap> NrDClasses(FullMatrixMonoid(3, 2));
+4
 
 # TraceMat
 gap> x := Matrix(GF(2 ^ 2),
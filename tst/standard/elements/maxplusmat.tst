@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local A, S, mat, mat2, mat3, x
+#@local A, S, mat, mat2, mat3, x, y
 gap> START_TEST("Semigroups package: standard/elements/maxplusmat.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -608,6 +608,56 @@ rix
 gap> x := Matrix(IsNTPMatrix, [[1, 1], [0, 0]], 5, -10);
 Error, the 3rd argument (a pos. int.) is not > 0
 
+# maxplusmat: products in the kernel, 1/1
+gap> x := Matrix(IsMaxPlusMatrix, [[0, -infinity], [2, 1]]);;
+gap> y := Matrix(IsMaxPlusMatrix, [[1, 3], [-infinity, 0]]);;
+gap> x * y = Matrix(IsMaxPlusMatrix, [[1, 3], [3, 5]]);
+true
+gap> x := Matrix(IsMaxPlusMatrix, [[2 ^ 59]]);;
+gap> x * x = Matrix(IsMaxPlusMatrix, [[2 ^ 60]]);
+true
+gap> x * x * x * x = Matrix(IsMaxPlusMatrix, [[2 ^ 61]]);
+true
+gap> x := Matrix(IsMaxPlusMatrix, [[2 ^ 62, 0], [-infinity, 1]]);;
+gap> x * x = Matrix(IsMaxPlusMatrix, [[2 ^ 63, 2 ^ 62], [-infinity, 2]]);
+true
+gap> x := Matrix(IsMaxPlusMatrix, [[2 ^ 100]]);;
+gap> x * x = Matrix(IsMaxPlusMatrix, [[2 ^ 101]]);
+true
+gap> x := Matrix(IsMinPlusMatrix, [[-2 ^ 70, infinity], [0, 1]]);;
+gap> x * x = Matrix(IsMinPlusMatrix, [[-2 ^ 71, infinity], [-2 ^ 70, 2]]);
+true
+gap> x := Matrix(IsProjectiveMaxPlusMatrix, [[2 ^ 62, 0], [-infinity, 1]]);;
+gap> x * x = Matrix(IsProjectiveMaxPlusMatrix,
+>                   [[0, -2 ^ 62], [-infinity, 2 - 2 ^ 63]]);
+true
+gap> x := Matrix(IsNTPMatrix, [[2 ^ 40, 1], [0, 2 ^ 40]], 2 ^ 70, 3);;
+gap> x * x = Matrix(IsNTPMatrix, [[2 ^ 70, 2 ^ 41], [0, 2 ^ 70]], 2 ^ 70, 3);
+true
+gap> x := Matrix(IsMinPlusMatrix, [[0, infinity], [2, 1]]);;
+gap> y := Matrix(IsMinPlusMatrix, [[1, 3], [infinity, 0]]);;
+gap> x * y = Matrix(IsMinPlusMatrix, [[1, 3], [3, 1]]);
+true
+gap> x := Matrix(IsTropicalMaxPlusMatrix, [[0, -infinity], [2, 1]], 3);;
+gap> y := Matrix(IsTropicalMaxPlusMatrix, [[1, 3], [-infinity, 0]], 3);;
+gap> x * y = Matrix(IsTropicalMaxPlusMatrix, [[1, 3], [3, 3]], 3);
+true
+gap> x := Matrix(IsTropicalMinPlusMatrix, [[2, infinity], [3, 1]], 3);;
+gap> y := Matrix(IsTropicalMinPlusMatrix, [[1, 3], [infinity, 0]], 3);;
+gap> x * y = Matrix(IsTropicalMinPlusMatrix, [[3, 3], [3, 1]], 3);
+true
+gap> x := Matrix(IsProjectiveMaxPlusMatrix, [[0, -infinity], [2, 1]]);;
+gap> y := Matrix(IsProjectiveMaxPlusMatrix, [[1, 3], [-infinity, 0]]);;
+gap> x * y = Matrix(IsProjectiveMaxPlusMatrix, [[-4, -2], [-2, 0]]);
+true
+gap> x := Matrix(IsProjectiveMaxPlusMatrix, [[-infinity]]);;
+gap> x * x = x;
+true
+gap> x := Matrix(IsNTPMatrix, [[1, 2], [0, 4]], 2, 3);;
+gap> y := Matrix(IsNTPMatrix, [[3, 1], [2, 2]], 2, 3);;
+gap> x * y = Matrix(IsNTPMatrix, [[4, 2], [2, 2]], 2, 3);
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/elements/maxplusmat.tst");
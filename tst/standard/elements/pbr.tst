@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local A, B, P, S, coll, f, filename, pos, x, y
+#@local A, B, P, S, coll, f, filename, ht, pos, x, y
 gap> START_TEST("Semigroups package: standard/elements/pbr.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -501,6 +501,37 @@ IO_Error
 gap> IO_Pickle(f, x);
 IO_Error
 
+# pbr: \*, \=, \<, and ChooseHashFunction in the kernel, 1/1
+gap> x := Transformation([3, 1, 4, 4, 2]);;
+gap> y := Transformation([2, 5, 5, 1, 3]);;
+gap> AsPBR(x) * AsPBR(y) = AsPBR(x * y);
+true
+gap> AsPBR(y) * AsPBR(x) = AsPBR(y * x);
+true
+gap> x := Bipartition([[1, -2], [2, 3, -1], [-3]]);;
+gap> y := Bipartition([[1, 2], [3, -1, -3], [-2]]);;
+gap> AsPBR(x) * AsPBR(y) = AsPBR(x * y);
+true
+gap> x := PBR([[-1, 1], [2]], [[-2], [1, 2]]);;
+gap> y := PBR([[-1, 1], [2]], [[-2], [1]]);;
+gap> x = y;
+false
+gap> y < x;
+true
+gap> x < y;
+false
+gap> (x * y) * x = x * (y * x);
+true
+gap> S := FullPBRMonoid(1);;
+gap> ht := HTCreate(S.1);;
+gap> for x in S do
+> HTAdd(ht, x, true);
+> od;
+gap> ForAll(S, x -> HTValue(ht, x) = true);
+true
+gap> ChooseHashFunction(S.1, 101).func = PBR_HASH;
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/elements/pbr.tst");
@@ -775,6 +775,45 @@ gap> IsomorphismSemigroups(s, t) <> fail;
 true
 gap> SetInfoLevel(InfoFpSemigroup, prevFpSemigroupInfoLevel);;
 
+# Test the kernel helpers used by StzSimplifyPresentation
+gap> SEMIGROUPS.StzReplaceSubwordRel([1, 1, 1, 2, 1, 1], [1, 1], [3]);
+[ 3, 1, 2, 3 ]
+gap> SEMIGROUPS.StzReplaceSubwordRel([1, 2], [1, 2, 3], [3]);
+[ 1, 2 ]
+gap> f := FreeSemigroup(2);;
+gap> stz := StzPresentation(f / [[f.1, f.1]]);;
+gap> SetRelationsOfStzPresentation(stz, [[[1, 1, 1, 1], [1, 1]],
+> [[2, 1, 1], [2]]]);
+gap> SEMIGROUPS.StzCountRelationSubwords(stz, [1, 1]);
+4
+gap> SetRelationsOfStzPresentation(stz, [[[1, 2, 1, 2], [1, 2]],
+> [[2, 1, 2, 1, 2], [1, 2, 1, 2, 1]], [[1, 2, 1, 2, 2], [2]]]);
+gap> r := SEMIGROUPS.StzFrequentSubwordCheck(stz);;
+gap> r.reduction;
+18
+gap> r.word;
+[ 1, 2, 1, 2 ]
+gap> r := SEMIGROUPS.StzDuplicateRelsCheck(stz);;
+gap> r.reduction;
+24
+gap> r.argument;
+0
+gap> SetRelationsOfStzPresentation(stz, [[[1, 2], [2, 1]], [[2], [1, 1]],
+> [[1, 2], [2, 1]], [[2, 1], [1, 2]]]);
+gap> r := SEMIGROUPS.StzDuplicateRelsCheck(stz);;
+gap> r.reduction;
+13
+gap> r.argument;
+1
+gap> SetRelationsOfStzPresentation(stz, [[[2], [1, 1, 1]], [[1, 2], [2, 1]]]);
+gap> r := SEMIGROUPS.StzRedundantGeneratorCheck(stz);;
+gap> r.reduction;
+9
+gap> r.argument;
+2
+gap> r.infoRel;
+1
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/fp/tietze.tst");
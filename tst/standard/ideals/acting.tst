@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local I, J, S, acting, an, x, y
+#@local I, J, S, T, acting, an, x, y
 gap> START_TEST("Semigroups package: standard/ideals/acting.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -274,6 +274,40 @@ gap> I := SemigroupIdeal(S, x, rec(acting := true));;
 gap> SemigroupIdealData(I);
 <closed semigroup ideal data with 10 reps, 10 lambda-values, 8 rho-values>
 
+# Ideals of enumerated acting semigroups
+gap> S := FullTransformationMonoid(4);;
+gap> Size(S);
+256
+gap> I := SemigroupIdeal(S, Transformation([1, 1, 2, 3]));;
+gap> Size(I);
+232
+gap> SizeBlist(I!.DClassesInSupersemigroup);
+3
+gap> Transformation([1, 2, 4, 3]) in I;
+false
+gap> Transformation([2, 2, 2, 1]) in I;
+true
+gap> PartialPerm([1, 2]) in I;
+false
+gap> S := Semigroup([Transformation([2, 3, 4, 1, 5]),
+>                    Transformation([1, 1, 3, 5, 4]),
+>                    Transformation([5, 4, 3, 2, 2])]);;
+gap> T := Semigroup(GeneratorsOfSemigroup(S));;
+gap> Size(S) > 0;
+true
+gap> I := SemigroupIdeal(S, Transformation([5, 4, 3, 2, 2]));;
+gap> J := SemigroupIdeal(T, Transformation([5, 4, 3, 2, 2]));;
+gap> ForAll(FullTransformationMonoid(5), x -> (x in I) = (x in J));
+true
+gap> IsBound(I!.DClassesInSupersemigroup);
+true
+gap> IsBound(J!.DClassesInSupersemigroup);
+false
+gap> Size(I) = Size(J);
+true
+gap> Size(MinimalIdeal(S)) = Size(MinimalIdeal(T));
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/ideals/acting.tst");
@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local C, D, F, I, R, S, T, cong, hom, t, u
+#@local C, D, F, I, R, S, T, cong, hom, pairs, t, u
 gap> START_TEST("Semigroups package: standard/libsemigroups/cong.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -269,6 +269,97 @@ gap> ImagesElm(C, S.1);
 gap> ImagesElm(C, S.3);
 [ s3 ]
 
+# CongruenceReduceMany and CongruenceTestMembershipManyNC
+gap> S := FreeSemigroup(2);
+<free semigroup on the generators [ s1, s2 ]>
+gap> C := SemigroupCongruence(S, [[S.1, S.2]]);
+<2-sided semigroup congruence over <free semigroup on the generators 
+[ s1, s2 ]> with 1 generating pairs>
+gap> CongruenceTestMembershipManyNC(C,
+> [[[1], [2]], [[1], [1, 2]], [[2, 1], [1, 1]]]);
+[ true, false, true ]
+gap> CongruenceTestMembershipManyNC(C, []);
+[  ]
+gap> CongruenceReduceMany(C, [[1], [2], [1, 2]])
+> = List([[1], [2], [1, 2]], w -> CongruenceReduce(C, w));
+true
+gap> CongruenceReduceMany(C, []);
+[  ]
+gap> S := FreeBand(2);
+<free band on the generators [ x1, x2 ]>
+gap> C := LeftSemigroupCongruence(S, [[S.1, S.1 * S.2]]);
+<left semigroup congruence over <free band on the generators [ x1, x2 ]> with 
+1 generating pairs>
+gap> CongruenceTestMembershipManyNC(C, [[[1], [1, 2]], [[2], [2, 1]]])
+> = [CongruenceTestMembershipNC(C, S.1, S.1 * S.2),
+>    CongruenceTestMembershipNC(C, S.2, S.2 * S.1)];
+true
+gap> CongruenceReduceMany(C, List(S, x -> MinimalFactorization(S, x)))
+> = List(S, x -> CongruenceReduce(C, x));
+true
+
+# CongruenceTestMembershipNC for a list of pairs
+gap> CongruenceTestMembershipNC(C, [[S.1, S.1 * S.2], [S.2, S.2 * S.1]])
+> = [CongruenceTestMembershipNC(C, S.1, S.1 * S.2),
+>    CongruenceTestMembershipNC(C, S.2, S.2 * S.1)];
+true
+gap> CongruenceTestMembershipNC(C, []);
+[  ]
+gap> S := FullTransformationMonoid(3);;
+gap> C := SemigroupCongruence(S, [[S.2, S.3]]);;
+gap> pairs := List(Tuples([1 .. 5], 2),
+>                  x -> [AsList(S)[x[1]], AsList(S)[x[2]]]);;
+gap> CongruenceTestMembershipNC(C, pairs)
+> = List(pairs, x -> CongruenceTestMembershipNC(C, x[1], x[2]));
+true
+gap> EquivalenceRelationLookup(C)
+> = List(EnumeratorCanonical(S),
+>        x -> Minimum(List(ImagesElm(C, x), y -> PositionCanonical(S, y))));
+true
+gap> CongruenceTestMembershipNC(C, pairs)
+> = List(pairs, x -> CongruenceTestMembershipNC(C, x[1], x[2]));
+true
+gap> C = SemigroupCongruence(S, [[S.3, S.2]]);
+true
+gap> IsSubrelation(C, SemigroupCongruence(S, [[S.1, S.1]]));
+true
+
+# Options for the runners of a libsemigroups Congruence
+gap> F := FreeSemigroup(2);;
+gap> R := [[F.1 ^ 3, F.1], [F.2 ^ 2, F.2], [F.1 * F.2, F.2 * F.1]];;
+gap> S := F / R;;
+gap> Size(S : todd_coxeter := rec(strategy := "felsch",
+>                                 lookahead_extent := "full",
+>                                 lookahead_style := "hlt",
+>                                 def_max := 10 ^ 4));
+5
+gap> S := F / R;;
+gap> Size(S : todd_coxeter := rec(strategy := "hlt", large_collapse := 1000),
+>             knuth_bendix := rec(max_rules := 1000,
+>                                 overlap_policy := "AB_BC"));
+5
+
+# Racing the algorithms for a libsemigroups Congruence
+gap> S := F / R;;
+gap> Size(S : race := rec(runners := [rec(algorithm := "todd_coxeter",
+>                                         strategy := "felsch"),
+>                                     rec(algorithm := "knuth_bendix",
+>                                         max_rules := 1000),
+>                                     rec(algorithm := "kambites")],
+>                         max_threads := 2));
+5
+gap> C := UnderlyingCongruence(S);;
+gap> C!.LibsemigroupsCongruenceRace.winner in ["todd_coxeter", "knuth_bendix"];
+true
+gap> C!.LibsemigroupsCongruenceRace.index in [1, 2];
+true
+gap> S := F / R;;
+gap> Size(S : race := rec(runners := [rec(algorithm := "knuth_bendix")]));
+5
+gap> C := UnderlyingCongruence(S);;
+gap> C!.LibsemigroupsCongruenceRace.winner;
+"knuth_bendix"
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/libsemigroups/cong.tst");
@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local F, R, S, e, it
+#@local C, F, R, S, T, e, it, map, n, x, y
 gap> START_TEST("Semigroups package: standard/libsemigroups/sims1.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -138,6 +138,12 @@ gap> OutNeighbours(WordGraph(NextIterator(it)));
 [ [ 2, 2 ], [ 2, 2 ] ]
 gap> NextIterator(it);
 fail
+gap> NumberOfRightCongruences(S, 4, [] : min_classes := 3);
+3
+gap> NumberOfRightCongruences(S, 2, [] : min_classes := 2);
+2
+gap> NumberOfLeftCongruences(S, 4, [] : min_classes := 4);
+1
 gap> F := FreeSemigroupAndAssignGeneratorVars("a", "b");
 <free semigroup on the generators [ a, b ]>
 gap> R := [[a ^ 3, a], [b ^ 2, b], [(a * b) ^ 2, a]];
@@ -374,6 +380,85 @@ gap> IteratorOfLeftCongruences(S, Size(S), [[S.1, fail], [S.1, S.3]]);
 Error, the 3rd argument (a list of length 2) must consist of pairs of elements\
  of the 1st argument (a semigroup)
 
+# NumberOfRight/LeftCongruences with a minimum number of classes
+gap> S := PartitionMonoid(2);;
+gap> NumberOfRightCongruences(S, 10, [] : min_classes := 10)
+> = NumberOfRightCongruences(S, 10) - NumberOfRightCongruences(S, 9);
+true
+gap> NumberOfLeftCongruences(S, 3, [] : min_classes := 2)
+> = NumberOfLeftCongruences(S, 3) - NumberOfLeftCongruences(S, 1);
+true
+
+# IteratorOfRight/LeftCongruences using several threads
+gap> S := PartitionMonoid(2);;
+gap> n := 0;;
+gap> for C in IteratorOfRightCongruences(S, 6, [] : nr_threads := 2) do
+>   n := n + 1;
+> od;
+gap> n = NumberOfRightCongruences(S, 6);
+true
+gap> x := [];;
+gap> for C in IteratorOfLeftCongruences(S, 4, [] : nr_threads := 2) do
+>   AddSet(x, OutNeighbours(WordGraph(C)));
+> od;
+gap> y := [];;
+gap> for C in IteratorOfLeftCongruences(S, 4) do
+>   AddSet(y, OutNeighbours(WordGraph(C)));
+> od;
+gap> x = y;
+true
+gap> NumberOfRightCongruences(S, 10, [] : nr_threads := 2)
+> = NumberOfRightCongruences(S, 10);
+true
+
+# Sims1 with a presentation obtained directly from a FroidurePin
+gap> S := PartitionMonoid(2);;
+gap> T := AsSemigroup(IsFpSemigroup, S);;
+gap> NumberOfRightCongruences(S) = NumberOfRightCongruences(T);
+true
+gap> NumberOfLeftCongruences(S) = NumberOfLeftCongruences(T);
+true
+gap> S := Semigroup(Transformation([2, 3, 1]), Transformation([2, 2, 3]));;
+gap> T := AsSemigroup(IsFpSemigroup, S);;
+gap> NumberOfRightCongruences(S, 4) = NumberOfRightCongruences(T, 4);
+true
+
+# IteratorOfCongruences
+gap> S := PartitionMonoid(2);;
+gap> T := PartitionMonoid(2);;
+gap> x := [];;
+gap> for C in IteratorOfCongruences(S, 5) do
+>   AddSet(x, EquivalenceRelationCanonicalLookup(C));
+> od;
+gap> x = Set(Filtered(CongruencesOfSemigroup(T),
+>                     C -> NrEquivalenceClasses(C) <= 5),
+>            EquivalenceRelationCanonicalLookup);
+true
+gap> n := 0;;
+gap> for C in IteratorOfCongruences(S) do
+>   n := n + 1;
+> od;
+gap> n = Length(CongruencesOfSemigroup(T));
+true
+gap> C := NextIterator(IteratorOfCongruences(S, 1));;
+gap> IsSemigroupCongruence(C);
+true
+gap> NrEquivalenceClasses(C);
+1
+
+# MinimalTransformationRepresentation
+gap> S := FullTransformationMonoid(3);;
+gap> map := MinimalTransformationRepresentation(S);;
+gap> Size(Range(map));
+27
+gap> DegreeOfTransformationSemigroup(Range(map))
+> <= DegreeOfTransformationSemigroup(
+>      Range(SmallerDegreeTransformationRepresentation(S)));
+true
+gap> MinimalTransformationRepresentation(
+> AsSemigroup(IsFpSemigroup, FreeSemigroup(2)));
+Error, the argument (an fp semigroup) must be finite
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/libsemigroups/sims1.tst");
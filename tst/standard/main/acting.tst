@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local R, S, acting, f, gens, iter, r, s, x
+#@local R, S, act, acting, f, gens, iter, list, m, o, r, s, x
 gap> START_TEST("Semigroups package: standard/main/acting.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -406,6 +406,55 @@ gap> MinimalIdeal(S);
 gap> ConstantTransformation(3, 1) in S;
 false
 
+# acting: LambdaOrbMult and RhoOrbMult, computed without recursion
+gap> S := Semigroup(Transformation([2, 3, 4, 5, 6, 7, 1]),
+>                   Transformation([2, 1, 3, 4, 5, 6, 7]),
+>                   Transformation([1, 1, 3, 4, 5, 6, 7]));;
+gap> o := Enumerate(LambdaOrb(S));;
+gap> act := LambdaAct(S);;
+gap> ForAll([2 .. Length(OrbSCC(o))], m -> ForAll(OrbSCC(o)[m], i ->
+> act(o[i], LambdaOrbMult(o, m, i)[2]) = o[OrbSCC(o)[m][1]]
+> and act(o[OrbSCC(o)[m][1]], LambdaOrbMult(o, m, i)[1]) = o[i]));
+true
+gap> o := Enumerate(RhoOrb(S));;
+gap> act := RhoAct(S);;
+gap> ForAll([2 .. Length(OrbSCC(o))], m -> ForAll(OrbSCC(o)[m], i ->
+> act(o[OrbSCC(o)[m][1]], RhoOrbMult(o, m, i)[1]) = o[i]));
+true
+gap> Size(S);
+823543
+
+# ElementsInSemigroup
+gap> S := Semigroup([Transformation([2, 3, 4, 5, 1, 6, 6]),
+>                    Transformation([1, 1, 3, 4, 5, 6, 7]),
+>                    Transformation([7, 2, 3, 4, 5, 6, 1])]);;
+gap> list := Concatenation(List([1 .. 200], i -> Random(S)),
+>                          List([1 .. 200], i -> RandomTransformation(7)));;
+gap> ElementsInSemigroup(S, list) = List(list, x -> x in S);
+true
+gap> ForAll(ElementsInSemigroup(S, list{[1 .. 200]}), IdFunc);
+true
+gap> ElementsInSemigroup(S, [PartialPerm([1, 2]), ,
+>                            Transformation([1, 2, 3, 4, 5, 6, 7, 8, 1])]);
+[ false, false, false ]
+gap> ElementsInSemigroup(S, []);
+[  ]
+gap> S := InverseSemigroup([PartialPerm([1, 2, 3], [2, 3, 1]),
+>                           PartialPerm([1, 2], [1, 2])]);;
+gap> list := List([1 .. 50], i -> RandomPartialPerm(3));;
+gap> ElementsInSemigroup(S, list) = List(list, x -> x in S);
+true
+gap> S := Semigroup([Transformation([2, 3, 4, 5, 6, 7, 8, 1]),
+>                    Transformation([2, 1]),
+>                    Transformation([1, 1])]);;
+gap> ElementsInSemigroup(S, [Transformation([1, 1]),
+>                            Transformation([9, 1, 2, 3, 4, 5, 6, 7, 8]),
+>                            Transformation([3, 2, 1]),
+>                            PartialPerm([2, 1])]);
+[ true, false, true, false ]
+gap> IsClosedData(SemigroupData(S));
+false
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/main/acting.tst");
@@ -8,7 +8,7 @@
 #############################################################################
 ##
 
-#@local I, S, T, acting, an, regular, x
+#@local I, S, T, acting, an, coll, iter, nr, o, orbs, regular, x
 gap> START_TEST("Semigroups package: standard/main/semiact.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -198,6 +198,54 @@ true
 gap> Number(SymmetricInverseMonoid(4), x -> x in S) = Size(S);
 true
 
+# Graded orbits, with a limit on the number of values stored
+gap> S := FullTransformationMonoid(5);;
+gap> SetGradedOrbsLimit(GradedLambdaOrbs(S), 10);
+gap> coll := [Transformation([1, 1, 2, 3, 4]), Transformation([1, 1, 1, 2, 3]),
+>             Transformation([1, 1, 1, 1, 2]),
+>             Transformation([2, 2, 3, 4, 5])];;
+gap> List(coll, x -> Length(GradedLambdaOrb(S, x, true)));
+[ 5, 10, 10, 5 ]
+gap> GradedLambdaOrbs(S)!.nrevicted;
+3
+gap> IsIdenticalObj(GradedLambdaOrb(S, coll[4], true),
+>                   GradedLambdaOrb(S, coll[1], true));
+true
+gap> Position(GradedLambdaOrbs(S), LambdaFunc(S)(coll[2]));
+fail
+gap> orbs := GradedLambdaOrbsOfColl(S, [coll[2], coll[3], coll[2]]);;
+gap> List(orbs, Length);
+[ 10, 10, 10 ]
+gap> IsIdenticalObj(orbs[1], orbs[3]);
+true
+gap> GradedLambdaOrbs(S)!.nrevicted;
+5
+gap> List(GradedRhoOrbsOfColl(S, coll), Length);
+[ 10, 25, 15, 10 ]
+gap> SetGradedOrbsLimit(GradedRhoOrbs(S), 25);
+gap> GradedRhoOrbs(S)!.nrevicted;
+2
+gap> SetGradedOrbsLimit(GradedRhoOrbs(S), 0);
+Error, the 2nd argument <limit> must be a positive integer or infinity
+gap> SetGradedOrbsLimit(S, 10);
+Error, the 1st argument <graded> must be graded lambda or rho orbs
+gap> GradedLambdaOrbsOfColl(S, 1);
+Error, the 2nd argument <coll> must be a list or collection
+gap> Length(GradedLambdaOrb(S, coll[3], false));
+10
+gap> S := FullTransformationMonoid(4);;
+gap> SetGradedOrbsLimit(GradedLambdaOrbs(S), 4);
+gap> iter := IteratorOfGradedLambdaOrbs(S);;
+gap> nr := 0;;
+gap> for o in iter do nr := nr + 1; od;
+gap> nr;
+4
+gap> iter := IteratorOfGradedLambdaOrbs(S);;
+gap> nr := 0;;
+gap> for o in iter do nr := nr + Length(o); od;
+gap> nr = Length(LambdaOrb(S)) - 1;
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/main/semiact.tst");
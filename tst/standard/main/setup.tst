@@ -9,8 +9,9 @@
 #############################################################################
 ##
 
-#@local G, M, R, S, acting, b, data, forflatplainlists, func, o, r, rank, s
-#@local schutz, x, y
+#@local G, M, R, S, acting, b, data, f, forflatplainlists, func, lambda
+#@local o, r, rank, rho, s
+#@local schutz, stab, x, y
 gap> START_TEST("Semigroups package: standard/main/setup.tst");
 gap> LoadPackage("semigroups", false);;
 
@@ -1139,6 +1140,63 @@ rec( data := fail, func := function( v, data ) ... end )
 gap> x.func(fail, fail);
 1
 
+# setup: LambdaFuncLookup and RhoFuncLookup for transformations
+gap> S := FullTransformationMonoid(4);;
+gap> lambda := SEMIGROUPS.LambdaFuncLookup(S);;
+gap> rho := SEMIGROUPS.RhoFuncLookup(S);;
+gap> ForAll(S, f -> lambda(f) = LambdaFunc(S)(f) and rho(f) = RhoFunc(S)(f));
+true
+gap> IsIdenticalObj(lambda(S.1), lambda(S.2));
+true
+gap> f := Transformation([3, 3, 5, 1, 2, 2]);;
+gap> ForAll([0 .. 8], n -> IMAGE_SET_TRANS_INT_SCRATCH([], f, n)
+>                          = IMAGE_SET_TRANS_INT(f, n));
+true
+gap> ForAll([0 .. 8], n -> FLAT_KERNEL_TRANS_INT_SCRATCH([], f, n)
+>                          = FLAT_KERNEL_TRANS_INT(f, n));
+true
+gap> f := Transformation([70000, 1], [1, 70000]);;
+gap> IMAGE_SET_TRANS_INT_SCRATCH([], f, 3) = IMAGE_SET_TRANS_INT(f, 3);
+true
+gap> FLAT_KERNEL_TRANS_INT_SCRATCH([], f, 3) = FLAT_KERNEL_TRANS_INT(f, 3);
+true
+gap> S := Semigroup(GeneratorsOfMonoid(FullTransformationMonoid(5)),
+>                   rec(acting := true));;
+gap> NrRClasses(S);
+52
+gap> NrLClasses(S);
+31
+gap> Size(S);
+3125
+
+
+# STAB_CHAIN_CONTAINS
+gap> stab := StabChainImmutable(Group((1, 2, 3), (1, 2)(4, 5, 6)));;
+gap> ForAll(SymmetricGroup(7),
+>           x -> STAB_CHAIN_CONTAINS(stab, x)
+>                = (SiftedPermutation(stab, x) = ()));
+true
+gap> STAB_CHAIN_CONTAINS(stab, (1, 2, 3)(4, 6, 5));
+true
+gap> STAB_CHAIN_CONTAINS(stab, (4, 5));
+false
+gap> STAB_CHAIN_CONTAINS(stab, (70000, 70001));
+false
+gap> STAB_CHAIN_CONTAINS(stab, ());
+true
+gap> STAB_CHAIN_CONTAINS(StabChainImmutable(Group(())), (1, 2));
+false
+gap> STAB_CHAIN_CONTAINS(StabChainImmutable(Group(())), ());
+true
+gap> STAB_CHAIN_CONTAINS(stab, Transformation([1, 1]));
+Error, the 2nd argument must be a permutation, found a transformation (small)
+gap> S := SymmetricInverseMonoid(6);;
+gap> Size(S);
+13327
+gap> ForAll(GreensDClasses(S),
+>           D -> Size(D) = NrHClasses(D) * Size(GroupHClass(D)));
+true
+
 #
 gap> SEMIGROUPS.StopTest();
 gap> STOP_TEST("Semigroups package: standard/main/setup.tst");
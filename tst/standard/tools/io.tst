@@ -176,6 +176,56 @@ gap> for x in it do od;
 gap> IsDoneIterator(it);
 true
 
+# Test binary generators files
+gap> name := Filename(DirectoryTemporary(), "testdata.bin");;
+gap> gens := [[Transformation([2, 3, 1]), Transformation([1, 1])],
+>             [PartialPerm([1, 3], [3, 2]), PartialPerm([])],
+>             [Bipartition([[1, -2], [2], [-1]])],
+>             [Matrix(IsBooleanMat, [[1, 0, 1], [1, 1, 0], [0, 0, 1]])],
+>             FullTransformationMonoid(2),
+>             [Transformation(Concatenation([2 .. 300], [1]))]];;
+gap> WriteGenerators(name, gens : binary);
+IO_OK
+gap> ReadGenerators(name) = Concatenation(gens{[1 .. 4]},
+>                                         [GeneratorsOfSemigroup(gens[5])],
+>                                         gens{[6]});
+true
+gap> ReadGenerators(name, 3);
+[ <bipartition: [ 1, -2 ], [ 2 ], [ -1 ]> ]
+gap> ReadGenerators(name, 7);
+Error, the file only has 6 entries
+gap> ReadGenerators(name, -1);
+Error, the 2nd argument is not a positive integer
+gap> WriteGenerators(name, [[PartialPerm([2], [1])]], "a");
+IO_OK
+gap> ReadGenerators(name, 7);
+[ [2,1] ]
+gap> ReadGenerators(name, 4) = gens[4];
+true
+gap> it := IteratorFromGeneratorsFile(name);
+<iterator>
+gap> NextIterator(it);
+[ Transformation( [ 2, 3, 1 ] ), Transformation( [ 1, 1 ] ) ]
+gap> IsDoneIterator(it);
+false
+gap> for x in it do od;
+gap> IsDoneIterator(it);
+true
+gap> it := ShallowCopy(it);
+<iterator>
+gap> NextIterator(it);
+[ Transformation( [ 2, 3, 1 ] ), Transformation( [ 1, 1 ] ) ]
+gap> WriteGenerators(name, [[(1, 2)]], "a");
+Error, the 2nd argument is incompatible with the file format
+gap> file := IO_CompressedFile(name, "r");;
+gap> SEMIGROUPS.WriteGeneratorsBinary(file, gens, "w");
+Error, the 1st argument is not a string, binary generators files must be given\
+ by name
+gap> IO_Close(file);
+true
+gap> SEMIGROUPS.ReadGeneratorsBinaryEntry(['x', []]);
+Error, unknown kind of entry 'x'
+
 # Test ReadMultiplicationTable
 # This test used to regularly fail in the CI Cygwin job, and was disabled.
 # This issue was fixed in https://github.com/semigroups/Semigroups/pull/1087/